@@ -23,9 +23,19 @@ PID::PID(double *Input, double *Output, double *Setpoint, double Kp, double Ki,
   myInput = Input;
   mySetpoint = Setpoint;
   inAuto = false;
+  algorithm = Algorithm::Classic;
+  dSource = D_Source::Measured;
+  inputRate = 0;
+  spWeight = 1;
+  derivTf = 0;
+  trackTt = 0;
+  feedForward = 0;
+  lastD = 0;
 
   PID::SetOutputLimits(0, 255);  // default output limit corresponds to
                                  // the arduino pwm limits
+  actMin = outMin;
+  actMax = outMax;
 
   SampleTime = 100;  // default Controller Sample Time is 0.1 seconds
 
@@ -61,6 +71,16 @@ bool PID::Compute() {
     double input = *myInput;
     double error = *mySetpoint - input;
     double dInput = (input - lastInput);
+    if (dSource == D_Source::External)
+      dInput = inputRate * ((double)SampleTime) / 1000;
+
+    if (algorithm == Algorithm::Filtered) {
+      *myOutput = ComputeFiltered(input, dInput);
+      lastInput = input;
+      lastTime = now;
+      return true;
+    }
+
     outputSum += (ki * error);
 
     /*Add Proportional on Measurement, if P_ON_M is specified*/
@@ -101,6 +121,61 @@ bool PID::Compute() {
     return false;
 }
 
+/* ComputeFiltered(...) *******************************************************
+ * 2-DOF form with a first-order filtered derivative (on measurement) and
+ * back-calculation anti-windup. The integral is driven by the error plus the
+ * difference between what the actuator actually received (PID output plus
+ * feed-forward, clamped to the actuator limits) and what was asked for, so it
+ * stops winding up as soon as the final command saturates rather than when
+ * the integral itself reaches outMin/outMax.
+ ******************************************************************************/
+double PID::ComputeFiltered(double input, double dInput) {
+  double setpoint = *mySetpoint;
+  double dt = ((double)SampleTime) / 1000;
+
+  double p = kp * (spWeight * setpoint - input);
+
+  /*kd is already scaled by 1/dt, so kd * dt is the continuous-time gain*/
+  double d = (derivTf / (derivTf + dt)) * lastD -
+             (kd * dt / (derivTf + dt)) * dInput;
+
+  double v = p + outputSum + d;
+  double output = v;
+  if (output > outMax)
+    output = outMax;
+  else if (output < outMin)
+    output = outMin;
+
+  double requested = v + feedForward;
+  double applied = output + feedForward;
+  if (applied > actMax)
+    applied = actMax;
+  else if (applied < actMin)
+    applied = actMin;
+
+  double tt = trackTt;
+  if (tt <= 0) {
+    /*Default tracking time sqrt(Ti * Td) = sqrt(Kd / Ki)*/
+    if (dispKi > 0 && dispKd > 0)
+      tt = sqrt(dispKd / dispKi);
+    else if (dispKi > 0)
+      tt = dispKp / dispKi;
+    else
+      tt = 1;
+  }
+  if (tt < dt) tt = dt;
+
+  outputSum += ki * (setpoint - input) + (dt / tt) * (applied - requested);
+  if (outputSum > outMax)
+    outputSum = outMax;
+  else if (outputSum < outMin)
+    outputSum = outMin;
+
+  this->lastP = p;
+  this->lastD = d;
+  return output;
+}
+
 /* SetTunings(...)*************************************************************
  * This function allows the controller's dynamic performance to be adjusted.
  * it's called automatically from the constructor, but tunings can also
@@ -147,6 +222,48 @@ void PID::SetSampleTime(int NewSampleTime) {
   }
 }
 
+/* SetAlgorithm(...) **********************************************************
+ * Switches between the classic and filtered control laws. The derivative
+ * filter state is cleared so the first filtered sample starts from rest.
+ ******************************************************************************/
+void PID::SetAlgorithm(Algorithm Algo) {
+  if (Algo != algorithm) lastD = 0;
+  algorithm = Algo;
+}
+
+/* SetFilterTunings(...) ******************************************************
+ * Setpoint weight, derivative filter and anti-windup tracking time constants
+ * for the filtered algorithm. Negative values are rejected.
+ ******************************************************************************/
+void PID::SetFilterTunings(double SpWeight, double Tf, double Tt) {
+  if (SpWeight < 0 || Tf < 0 || Tt < 0) return;
+  spWeight = SpWeight;
+  derivTf = Tf;
+  trackTt = Tt;
+}
+
+/* SetFeedForward(...) / SetActuatorLimits(...) ********************************
+ * The caller adds feed-forward after Compute() and clamps the sum to the
+ * actuator range. Telling the PID about both lets the filtered algorithm see
+ * the real saturation.
+ ******************************************************************************/
+void PID::SetFeedForward(double FeedForward) { feedForward = FeedForward; }
+
+void PID::SetActuatorLimits(double Min, double Max) {
+  if (Min >= Max) return;
+  actMin = Min;
+  actMax = Max;
+}
+
+/* SetDerivativeSource(...) / SetInputRate(...) *******************************
+ * With an external rate the per-sample input change is rate * sample time,
+ * so the derivative (and proportional on measurement) terms use the
+ * caller's estimate in place of the raw input difference.
+ ******************************************************************************/
+void PID::SetDerivativeSource(D_Source Source) { dSource = Source; }
+
+void PID::SetInputRate(double Rate) { inputRate = Rate; }
+
 /* SetOutputLimits(...)****************************************************
  *     This function will be used far more often than SetInputLimits.  while
  *  the input to the controller will generally be in the 0-1023 range (which is
@@ -193,6 +310,7 @@ void PID::SetMode(Mode mode) {
 void PID::Initialize() {
   outputSum = *myOutput;
   lastInput = *myInput;
+  lastD = 0;
   if (outputSum > outMax)
     outputSum = outMax;
   else if (outputSum < outMin)
@@ -226,6 +344,7 @@ PID::Mode PID::GetMode() const {
   return inAuto ? Mode::Automatic : Mode::Manual;
 }
 PID::Direction PID::GetDirection() const { return controllerDirection; }
+PID::Algorithm PID::GetAlgorithm() const { return algorithm; }
 double PID::GetLastP() const { return this->lastP; }
 double PID::GetLastI() const { return this->outputSum; }
 double PID::GetLastD() const { return this->lastD; }
@@ -7,6 +7,8 @@ class PID {
   enum Mode { Manual = 0, Automatic = 1 };
   enum Direction { Direct = 0, Reverse = 1 };
   enum class P_On { Measurement = 0, Error = 1 };
+  enum class Algorithm { Classic = 0, Filtered = 1 };
+  enum class D_Source { Measured = 0, External = 1 };
 
   // commonly used functions
   // **************************************************************************
@@ -51,6 +53,31 @@ class PID {
   // performed. Default is 100.
   void SetSampleTime(int);
 
+  // Selects the control law. Classic is the original algorithm. Filtered uses
+  // a first-order filter on the derivative, a weighted setpoint on the
+  // proportional term (2-DOF) and back-calculation anti-windup against the
+  // actuator limits after feed-forward has been added. P_On is ignored in
+  // Filtered mode; use the setpoint weight instead.
+  void SetAlgorithm(Algorithm);
+
+  // Tunings used by Algorithm::Filtered. SpWeight is the proportional setpoint
+  // weight (1 = P on error, 0 = P on measurement), Tf the derivative filter
+  // time constant and Tt the anti-windup tracking time constant, both in
+  // seconds. Tt = 0 selects sqrt(Ti * Td).
+  void SetFilterTunings(double SpWeight, double Tf, double Tt);
+
+  // Feed-forward added to the output by the caller, and the limits the
+  // actuator clamps the sum to. Filtered mode uses these to unwind the
+  // integral when the final actuator command saturates.
+  void SetFeedForward(double);
+  void SetActuatorLimits(double, double);
+
+  // Selects where the derivative comes from. Measured differences successive
+  // inputs. External uses the rate given to SetInputRate (input units per
+  // second), e.g. from a state estimator that already smooths it.
+  void SetDerivativeSource(D_Source);
+  void SetInputRate(double);
+
   // Display functions
   // ****************************************************************
   // These functions query the pid for interal values.they were created mainly
@@ -61,6 +88,7 @@ class PID {
   double GetKd() const;
   Mode GetMode() const;
   Direction GetDirection() const;
+  Algorithm GetAlgorithm() const;
   double GetLastP() const;
   double GetLastI() const;
   double GetLastD() const;
@@ -78,6 +106,8 @@ class PID {
 
   Direction controllerDirection;
   P_On pOn;
+  Algorithm algorithm;
+  D_Source dSource;
 
   // Pointers to the Input, Output, and Setpoint variables. This creates a hard
   // link between the variables and the PID, freeing the user from having to
@@ -91,6 +121,15 @@ class PID {
   unsigned long SampleTime;
   double outMin, outMax;
   bool inAuto, pOnE;
+
+  double spWeight;      // * setpoint weight on the proportional term
+  double derivTf;       // * derivative filter time constant (s)
+  double trackTt;       // * anti-windup tracking time constant (s)
+  double feedForward;   // * output offset applied after the PID
+  double actMin, actMax;
+  double inputRate;     // * externally supplied d(input)/dt
+
+  double ComputeFiltered(double input, double dInput);
 };
 
 class PID_v2 : public PID {
@@ -120,6 +159,13 @@ class PID_v2 : public PID {
     return this->output;
   }
 
+  // As Run(input), also supplying the input's rate of change for
+  // D_Source::External.
+  double Run(double input_, double rate_) {
+    this->SetInputRate(rate_);
+    return this->Run(input_);
+  }
+
  private:
   double input, output, setpoint;
 };
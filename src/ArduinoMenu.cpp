@@ -8,7 +8,14 @@
 #include "Free_Fonts.h"
 #include "Oven.h"
 #include "ElementPWM.h"
+#include "PowerAllocator.h"
+#include "CoolingControl.h"
+#include "RunRecorder.h"
+#include "Telemetry.h"
+#include "FastFormat.h"
 #include "logo.h"
+#include "RleImage.h"
+#include "BootProfiler.h"
 
 AiEsp32RotaryEncoder rotaryEncoder = AiEsp32RotaryEncoder(21,22, 5, -1, 2);
 
@@ -17,23 +24,155 @@ const int fan =           25;
 const int fryerElement =  26;
 const int mainElement =   27;
 
+// Element ratings and the current the oven may draw from its circuit. The two
+// elements only overlap when their combined current is within the cap.
+PowerAllocator powerAllocator({
+  1500.0f,  // main element W
+  1500.0f,  // fryer element W
+  230.0f,   // mains V
+  16.0f     // current cap A
+});
+
+// Fan on an LEDC channel. While heating it runs flat out for convection; in
+// the cool phase it follows the cool-down rate.
+CoolingController cooling({
+  fan,      // pin
+  0,        // LEDC channel
+  25000,    // PWM Hz
+  40.0f,    // kp, % per C/s
+  4.0f,     // ki, % per C/s per s
+  0.05f,    // C/s extra per C above setpoint
+  20,       // min duty while cooling %
+  0.3f,     // rate shortfall before door prompt C/s
+  20000     // ms flat out and short before door prompt
+});
+
+// Fills in each probe's reading when more than one is fitted, so the run's
+// history, log and telemetry carry the individual traces
+static void SampleProbes(ControlSample& sample) {
+  bool several = sensors.numProbes() > 1;
+  for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+    bool valid = several && i < sensors.numProbes() && sensors.healthy(i);
+    sample.probes[i] = valid ? sensors.reading(i) : ControlSample::NO_READING;
+  }
+}
+
+// Logs each probe's reading and fault state, one line per control tick
+void LogProbes() {
+  if (sensors.numProbes() < 2) return;
+  char line[96];
+  FastFormat text(line, sizeof(line));
+  text.str("Probes:");
+  for (uint8_t i = 0; i < sensors.numProbes(); ++i) {
+    text.chr(' ').str(sensors.name(i)).chr(':');
+    if (sensors.healthy(i)) {
+      text.temp(sensors.reading(i), 1);
+    } else {
+      text.chr('F').hex(sensors.fault(i), 2);
+    }
+  }
+  text.str(" Fused:").temp(sensors.fused(), 1).chr('\n');
+  Serial.print(line);
+}
+
+// Every probe is faulted or stale, so the temperature is frozen at its last
+// good value and the controller would heat without limit. The caller has
+// already cut the heat; this says why, on the serial log and the screen.
+static void ReportSensorFailure() {
+  char line[96];
+  FastFormat text(line, sizeof(line));
+  text.str("All temperature probes failed, heat cut:");
+  for (uint8_t i = 0; i < sensors.numProbes(); ++i) {
+    text.chr(' ').str(sensors.name(i)).str(":F").hex(sensors.fault(i), 2);
+  }
+  text.chr('\n');
+  Serial.print(line);
+
+  gfx.setTextFont(0);
+  gfx.setTextSize(1);
+  gfx.setTextColor(TFT_RED, TFT_BLACK);
+  gfx.setCursor(0, 0);
+  gfx.printf("Sensor failure! Heat off.     \n");
+}
+
+void DumpLastRun() {
+  gfx.fillScreen(TFT_BLACK);
+  gfx.setTextFont(0);
+  gfx.setTextSize(1);
+  gfx.setTextColor(TFT_BLUE, TFT_BLACK);
+  gfx.setCursor(0, 0);
+  if (runRecorder.dumpRun(0, Serial)) {
+    gfx.printf("Run %lu written to serial", (unsigned long)runRecorder.lastRunId());
+  } else {
+    gfx.printf("No recorded run");
+  }
+  WaitForButtonPress(10000);
+}
+
 void IRAM_ATTR readEncoderISR()
 {
 	rotaryEncoder.readEncoder_ISR();
 }
 
+// Brings up everything that isn't needed to show the logo: probes, stored
+// settings and the run recorder, then reads the probes until the filters
+// are primed so the first reading on screen is a settled one
+static BootProfiler boot;
+static SemaphoreHandle_t startupDone;
+#define WARMUP_SAMPLES 5
+
+static void startupTask(void*) {
+  uint32_t t = boot.now();
+  InitTempSensor();
+  boot.record("Sensors", t);
+
+  t = boot.now();
+  loadSettingsFromFlash();
+  applySensorSettings();
+  boot.record("Settings", t);
+
+  t = boot.now();
+  runRecorder.begin();
+  boot.record("Recorder", t);
+
+  t = boot.now();
+  for (uint8_t i = 0; i < WARMUP_SAMPLES; ++i) ReadTemp(true);
+  boot.record("Warm-up", t);
+
+  xSemaphoreGive(startupDone);
+  vTaskDelete(nullptr);
+}
+
+// Temperature and rate in the top right corner of the menu
+static void DrawIdleReadout() {
+  static char textBuffer[50];
+
+  gfx.setTextColor(TFT_RED, TFT_BLACK);
+  gfx.setTextFont(1);
+  gfx.setTextSize(1);
+  gfx.setTextDatum(TR_DATUM);
+  FastFormat text(textBuffer, sizeof(textBuffer));
+  text.spaces(2).decimal(TempRate(), 1, 0, true).str("C/s ").temp(DisplayTemp(), 0).chr('C');
+  gfx.drawString(textBuffer, 159, 8);
+  gfx.setTextFont(2);
+  gfx.setTextDatum(TL_DATUM);
+}
+
 void setup() {
+  uint32_t t = boot.now();
   Serial.begin(115200);
 
   // Setup SSR pins
   pinMode(mainElement, OUTPUT);
   pinMode(fryerElement, OUTPUT);
-  pinMode(fan, OUTPUT);
   digitalWrite(mainElement,0);
   digitalWrite(fryerElement,0);
-  digitalWrite(fan,1);
+  cooling.begin();
+  cooling.setFanDuty(100);
+  boot.record("Outputs", t);
 
-  // Initialize the screen
+  // Initialize the screen and show the logo straight away
+  t = boot.now();
   gfx.init();
   gfx.setRotation(3);
   gfx.setTextWrap(false);
@@ -41,38 +180,57 @@ void setup() {
   gfx.setTextColor(Red,Black);
   gfx.setTextSize(1);
   gfx.setTextFont(2);
+  RleImage::draw(gfx, 0, 0, LOGO_WIDTH, LOGO_HEIGHT, logoRle, sizeof(logoRle));
+  boot.record("Display", t);
+
+  // The rest comes up on the other core while the logo is showing
+  startupDone = xSemaphoreCreateBinary();
+  xTaskCreatePinnedToCore(startupTask, "startup", 8192, nullptr, 1, nullptr, 0);
 
   // Initialize the rotary encoder
+  t = boot.now();
 	SPI.begin();
   rotaryEncoder.begin();
 	rotaryEncoder.setup(readEncoderISR);
 	rotaryEncoder.setBoundaries(-1000000, 1000000, true);
 	rotaryEncoder.setAcceleration(50);
-
-  InitTempSensor();
-  loadProfilesFromFlash();
-  
-  // Display the logo
-  gfx.pushImage(0, 0, 160, 128, logo); // Display the logo
-  WaitForButtonPress(5000UL); 
+  boot.record("Encoder", t);
+
+  // A click skips the rest of the splash; startup normally finishes first
+  t = boot.now();
+  WaitForButtonPress(5000UL);
+  boot.record("Splash", t);
+  t = boot.now();
+  xSemaphoreTake(startupDone, portMAX_DELAY);
+  boot.record("Startup wait", t);
+
+  // Draw the menu now rather than on the first loop, so it's up as soon
+  // as the splash goes
+  t = boot.now();
   gfx.fillScreen(Black);
+  nav.doOutput();
+  DrawIdleReadout();
+  boot.record("Menu", t);
+  boot.report(Serial);
 }
 
-void StartReflowProfile(ReflowProfile& profile) {
-  // Convert ReflowProfile to SolderProfileParams (simple 4-phase profile)
-  SolderProfileParams params;
-  params.phases[0] = {"Preheat", 0, (float)profile.preheatTemp, 140000, 140000, false};
-
-  params.phases[1] = {"Soak", (float)profile.preheatTemp, (float)profile.soakTemp, 120000, 120000, false};
-  params.phases[2] = {"Peak", (float)profile.soakTemp, (float)profile.peakTemp, 70000, 120000, false};
-  params.phases[3] = {"Dwell", (float)profile.peakTemp, (float)profile.peakTemp, (uint32_t)profile.dwellTime*1000, (uint32_t)profile.dwellTime*1000, false};
-  params.phases[4] = {"Cool", (float)profile.peakTemp, 0, 90000, 90000, false};
-  params.numPhases = 5;
-
-  solderProfile.setProfile(params);
-
-  Serial.printf("Starting reflow profile: Preheat %dC, Soak %dC, Peak %dC, Dwell %ds\n",
-                profile.preheatTemp, profile.soakTemp, profile.peakTemp, profile.dwellTime);
+bool StartReflowProfile(ReflowProfile& profile, bool warmStart, bool waitAtEnd) {
+  // Convert ReflowProfile to profile segments. Ramps are rate-specified so
+  // their length follows the start temperature; Peak may stretch to 120s.
+  // Cool is capped at 90s: the oven never gets near its 0C target.
+  const ProfileSegment segments[] = {
+    // name      target                     duration                          rate                             min  max     maxRate
+    {"Preheat", (float)profile.preheatTemp, 0,                                profile.preheatRate / 10.0f,     0,   0,      false},
+    {"Soak",    (float)profile.soakTemp,    (uint32_t)profile.soakTime*1000,  0,                               0,   0,      false},
+    {"Peak",    (float)profile.peakTemp,    0,                                profile.peakRate / 10.0f,        0,   120000, false},
+    {"Dwell",   (float)profile.peakTemp,    (uint32_t)profile.dwellTime*1000, 0,                               0,   0,      false},
+    {"Cool",    0,                          90000,                            0,                               0,   90000,  false},
+  };
+  solderProfile.setProfile(segments, sizeof(segments) / sizeof(segments[0]));
+
+  Serial.printf("Starting reflow profile: Preheat %dC @%.1fC/s, Soak %dC %ds, Peak %dC @%.1fC/s, Dwell %ds\n",
+                profile.preheatTemp, profile.preheatRate / 10.0f, profile.soakTemp, profile.soakTime,
+                profile.peakTemp, profile.peakRate / 10.0f, profile.dwellTime);
   
   gfx.fillScreen(Black);
   gfx.setTextColor(Blue,Black);
@@ -82,13 +240,40 @@ void StartReflowProfile(ReflowProfile& profile) {
   float temp=0;
   InitPID();  
 
-  solderProfile.startReflow();
-  temp = GetFilteredTemp(ReadTemp(true));  
-  solderProfile.phases[0].startTemp = temp;
+  temp = ReadTemp(true);
+  if (!TempValid()) {
+    ReportSensorFailure();
+    WaitForButtonPress(60UL * 60000UL);
+    return false;
+  }
+  uint32_t joinMs = solderProfile.startReflow(temp, warmStart);
+  if (joinMs > 0) {
+    Serial.printf("Warm start at %.0fC, joining profile at %lus\n", temp, (unsigned long)(joinMs / 1000));
+  }
   solderProfile.initGraph(gfx, 0, 14, GFX_WIDTH, GFX_HEIGHT-14);
   solderProfile.drawGraph();
 
-  digitalWrite(fan,1); // Turn on the fan
+  // Record every tick of the run to flash
+  RunRecorder::RunInfo runInfo = {};
+  int profileIdx = &profile - profiles;
+  strncpy(runInfo.profileName, profileNames[profileIdx], sizeof(runInfo.profileName) - 1);
+  runInfo.preheatTemp = profile.preheatTemp;
+  runInfo.soakTemp = profile.soakTemp;
+  runInfo.peakTemp = profile.peakTemp;
+  runInfo.dwellTime = profile.dwellTime;
+  runInfo.preheatRate = profile.preheatRate;
+  runInfo.soakTime = profile.soakTime;
+  runInfo.peakRate = profile.peakRate;
+  runInfo.warmStart = warmStart;
+  runInfo.kp = myPID.GetKp();
+  runInfo.ki = myPID.GetKi();
+  runInfo.kd = myPID.GetKd();
+  runInfo.startTemp = temp;
+  runRecorder.startRun(runInfo);
+  telemetry.setMode(settings.telemetryBinary ? Telemetry::BINARY : Telemetry::TEXT);
+
+  cooling.reset();
+  cooling.setFanDuty(100); // Full fan for convection while heating
   unsigned long readtime = millis();
   float feedForwardAccumulator = -1000.0;
 
@@ -99,27 +284,47 @@ void StartReflowProfile(ReflowProfile& profile) {
 
   // --- Use ElementPWM for SSR control ---
   ElementPWM elementPWM(mainElement, fryerElement, 1000); // 1Hz PWM
-  uint8_t PWMMain = 0;
-  uint8_t PWMFryer = 0;
 
   while( solderProfile.currentPhase() != SolderProfile::COMPLETE) {    
     unsigned long elapsed = millis() - readtime;
-    if( elapsed > 250) {
+    // Tick no faster than the sensor produces readings
+    unsigned long tickMs = max(250UL, (unsigned long)SensorSamplePeriodMs());
+    if( elapsed > tickMs) {
       readtime = millis();
-      temp = GetFilteredTemp(ReadTemp(false));
+      temp = ReadTemp(false);
+      if (!TempValid()) {
+        elementPWM.off();
+        SetHeaterInput(0);
+        ReportSensorFailure();
+        // Close the run and the telemetry stream on a sample saying why
+        ControlSample sample = {};
+        sample.timeMs = solderProfile.profileTimeMs();
+        sample.temp = ControlTemp();
+        sample.fanDuty = cooling.fanDuty();
+        sample.phase = solderProfile.currentPhase();
+        sample.sensorFault = true;
+        SampleProbes(sample);
+        runRecorder.record(sample);
+        telemetry.send(sample);
+        telemetry.service();
+        runRecorder.endRun();
+        WaitForButtonPress(60UL * 60000UL);
+        return false;
+      }
 
-      // Update the PID target temperature based on the current phase
-      float setpoint = solderProfile.getSetpoint();
+      // Advance the profile clock, then one trajectory lookup gives the setpoint and the feed-forward slope
+      solderProfile.update(readtime, temp);
+      if (solderProfile.currentPhase() == SolderProfile::COMPLETE) break;
+      ReflowTrajectory::Sample traj = solderProfile.sample(10000); // 10s feed-forward lookahead
+      float setpoint = traj.setpoint;
       SetPIDTargetTemp(setpoint);
-
-      // Get PID output and control elements
-      float pidOutput = GetPIDOutput(temp);
+      // Low-latency readings on ramps, averaged readings on holds
+      SetSensorMode(SensorModeFor(traj.slope));
 
       // Add feed-forward control based on the current phase
       const float maxHeatRate = 100.0 / 100.0; // 100 degrees in 100 seconds
 
-      uint32_t nowMs = millis();
-      float feedForwardSlope = solderProfile.getFeedForwardSlope(10000); // seconds for feed-forward slope
+      float feedForwardSlope = traj.lookaheadSlope;
       float feedForwardPower = (feedForwardSlope / maxHeatRate) * 100.0; // Scale to 0-100
       feedForwardPower += setpoint / 10; // add term proportional to temperature
 
@@ -130,7 +335,11 @@ void StartReflowProfile(ReflowProfile& profile) {
         feedForwardAccumulator = (0.0f * feedForwardAccumulator) + (1.0f * feedForwardPower);
       }
 
-      // Adjust PID output with feed-forward control
+      // Tell the PID about the feed-forward so it can unwind against the final 0-100 clamp
+      SetPIDFeedForward(feedForwardAccumulator);
+
+      // Get PID output and adjust with feed-forward control
+      float pidOutput = GetPIDOutput(temp);
       pidOutput += feedForwardAccumulator;
       pidOutput = constrain(pidOutput, 0, 100); // Ensure output is within bounds
 
@@ -140,36 +349,74 @@ void StartReflowProfile(ReflowProfile& profile) {
       diffMax = diffMax * 0.999 + (fabs(diff)*0.001);
       diffCount++;
 
-      // Update the solder profile with the current temperature
-      solderProfile.update(temp, pidOutput); 
-
-      if( solderProfile.currentPhase() != SolderProfile::COMPLETE) {
-        Serial.printf(
-          "P:%s Temp:(A:%.1f,S:%.1f,D:%.1f) TStats(A:%.1f M:%.1f) FF:%.1f Out:%.0f (P:%.0f,I:%.0f,D:%.0f,F:%.0f)\n",
-          solderProfile.phases[solderProfile.currentPhase()].phaseName,
-          temp, setpoint, diff,
-          (diffCount > 0 ? diffSum / diffCount : 0.0f), diffMax,
-          feedForwardAccumulator,
-          pidOutput,
-          myPID.GetLastP(), myPID.GetLastI(), myPID.GetLastD(), feedForwardPower
-        );
+      // In the cool phase the fan tracks the cool-down rate; heat is still
+      // available if the oven falls below the ramp
+      bool doorPrompt = false;
+      if (solderProfile.isCooling()) {
+        cooling.update(readtime, temp, TempRate(), setpoint, traj.slope);
+        doorPrompt = cooling.doorOpenNeeded();
+      }
+
+      // Human-readable log line unless binary telemetry is selected
+      if (telemetry.mode() == Telemetry::TEXT) {
+        LogProbes();
+        char line[160];
+        FastFormat text(line, sizeof(line));
+        text.str("P:").str(solderProfile.phases[solderProfile.currentPhase()].phaseName)
+            .str(" Temp:(A:").temp(ControlTemp(), 1).str(",S:").decimal(setpoint, 1).str(",D:").decimal(diff, 1)
+            .str(") Rate:").decimal(TempRate(), 2).str(" Lead:").decimal(lagCompensator.lead(), 1)
+            .str(" TStats(A:").decimal(diffCount > 0 ? diffSum / diffCount : 0.0f, 1).str(" M:").decimal(diffMax, 1)
+            .str(") FF:").decimal(feedForwardAccumulator, 1)
+            .str(" Out:").decimal(pidOutput, 0)
+            .str(" (P:").decimal(myPID.GetLastP(), 0).str(",I:").decimal(myPID.GetLastI(), 0)
+            .str(",D:").decimal(myPID.GetLastD(), 0).str(",F:").decimal(feedForwardPower, 0)
+            .str(") Fan:").integer(cooling.fanDuty()).chr('\n');
+        Serial.print(line);
       }
 
       gfx.setTextColor(TFT_BLUE, TFT_BLACK);
       gfx.setTextSize(1);
       gfx.setCursor(0, 0);
-      gfx.printf("%.0fC %.0f:(%.0f,%.0f,%.0f,%.0f)    ", temp, pidOutput, myPID.GetLastP(), myPID.GetLastI(), myPID.GetLastD(), feedForwardAccumulator);
-
-      if( pidOutput > 50) {
-        PWMMain = 100;
-        PWMFryer = constrain((pidOutput-50) * 2, 0, 100);
+      char status[48];
+      FastFormat text(status, sizeof(status));
+      text.temp(ControlTemp(), 0).str("C ");
+      if (doorPrompt) {
+        gfx.setTextColor(TFT_RED, TFT_BLACK);
+        text.str("Open door! Fan:").integer(cooling.fanDuty()).chr('%').spaces(3);
       } else {
-        PWMMain = constrain(pidOutput * 2, 0, 100);
-        PWMFryer = 0;
+        // P/I/D/FF breakdown is in the serial log
+        text.decimal(TempRate(), 1, 0, true).str("C/s Out:").decimal(pidOutput, 0).chr('%').spaces(4);
       }
-      // Set PWM levels for this cycle
-      elementPWM.setPWM(PWMMain, PWMFryer);
+      gfx.print(status);
+
+      // Split the demand between the elements and set PWM levels for this cycle
+      PowerAllocator::Allocation power = powerAllocator.allocate(pidOutput);
+      elementPWM.setPWM(power.mainPWM, power.fryPWM, power.fryOffset);
+      SetHeaterInput(pidOutput);
+
+      ControlSample sample;
+      sample.timeMs = solderProfile.profileTimeMs();
+      sample.temp = ControlTemp();
+      sample.setpoint = setpoint;
+      sample.rate = TempRate();
+      sample.p = myPID.GetLastP();
+      sample.i = myPID.GetLastI();
+      sample.d = myPID.GetLastD();
+      sample.feedForward = feedForwardAccumulator;
+      sample.output = pidOutput;
+      sample.mainPWM = power.mainPWM;
+      sample.fryPWM = power.fryPWM;
+      sample.fanDuty = cooling.fanDuty();
+      sample.phase = solderProfile.currentPhase();
+      sample.sensorFault = false;
+      SampleProbes(sample);
+      runRecorder.record(sample);
+      telemetry.send(sample);
+
+      // Plot the temperature, setpoint, output, duties and probes on the profile graph
+      solderProfile.plot(readtime, sample);
     }
+    telemetry.service();
     // Regularly update the PWM outputs
     elementPWM.process();
 
@@ -181,10 +428,10 @@ void StartReflowProfile(ReflowProfile& profile) {
         Serial.println("Reflow aborted by user.");
         gfx.setCursor(0, 0);
         gfx.printf("Reflow Aborted.               \n");
-        digitalWrite(mainElement, 0);
-        digitalWrite(fryerElement, 0);
+        elementPWM.off();
+        runRecorder.endRun();
         delay(5000); // Give time to display the message
-        return;
+        return false;
       }
     }
   }
@@ -193,23 +440,132 @@ void StartReflowProfile(ReflowProfile& profile) {
   gfx.setCursor(0, 0);
   gfx.printf("Reflow Complete.               \n");       
   Serial.println("Reflow complete, stopping heat.");
-  digitalWrite(mainElement, 0);
-  digitalWrite(fryerElement, 0);
-  WaitForButtonPress(60UL * 60000UL); 
+  elementPWM.off();
+  runRecorder.endRun();
+  cooling.setFanDuty(100); // Keep cooling the boards
+  if (waitAtEnd) {
+    WaitForButtonPress(60UL * 60000UL); 
+  }
+  return true;
+}
+
+// Holds the oven at standbyTemp until the button is clicked. Returns false
+// if nobody clicks within timeoutMs, or if the probes fail.
+bool HoldStandby(int standbyTemp, int board, int runs, unsigned long timeoutMs) {
+  gfx.fillScreen(Black);
+  gfx.setTextFont(0);
+  gfx.setTextSize(1);
+
+  SetSensorMode(SENSOR_QUIET);
+  InitPID();
+  SetPIDTargetTemp(standbyTemp);
+  ElementPWM elementPWM(mainElement, fryerElement, 1000); // 1Hz PWM
+  cooling.setFanDuty(100);
+
+  unsigned long startMs = millis();
+  unsigned long readtime = 0;
+  while (!rotaryEncoder.isEncoderButtonClicked()) {
+    if (millis() - startMs > timeoutMs) {
+      elementPWM.off();
+      SetHeaterInput(0);
+      Serial.println("Standby timed out: no board loaded.");
+      return false;
+    }
+    if (millis() - readtime > 250) {
+      readtime = millis();
+      float temp = ReadTemp(false);
+      if (!TempValid()) {
+        elementPWM.off();
+        SetHeaterInput(0);
+        ReportSensorFailure();
+        WaitForButtonPress(60UL * 60000UL);
+        return false;
+      }
+      float pidOutput = constrain(GetPIDOutput(temp), 0, 100);
+      if (standbyTemp <= 0) pidOutput = 0;
+      PowerAllocator::Allocation power = powerAllocator.allocate(pidOutput);
+      elementPWM.setPWM(power.mainPWM, power.fryPWM, power.fryOffset);
+      SetHeaterInput(pidOutput);
+
+      gfx.setTextColor(TFT_BLUE, TFT_BLACK);
+      gfx.setCursor(0, 0);
+      char status[80];
+      FastFormat text(status, sizeof(status));
+      text.str("Standby ").temp(ControlTemp(), 0).str("C/").integer(standbyTemp).chr('C').spaces(4)
+          .str("\n\nLoad board ").integer(board).str(" of ").integer(runs).str("\nthen click to start  ");
+      gfx.print(status);
+    }
+    elementPWM.process();
+    delay(10);
+  }
+  elementPWM.off();
+  SetHeaterInput(0);
+  return true;
+}
+
+// Runs the profile once per batch board, back to back. Each board joins the
+// profile at the oven's current temperature instead of replaying preheat,
+// and the oven idles at the standby temperature while the next board is loaded.
+void StartReflowBatch(ReflowProfile& profile) {
+  const int maxBoards = 50;
+  unsigned long cycleMs[maxBoards];
+  int runs = constrain(settings.batchRuns, 1, maxBoards);
+  int completed = 0;
+  unsigned long batchStartMs = millis();
+
+  for (int board = 1; board <= runs; ++board) {
+    unsigned long boardStartMs = millis();
+    if (board > 1 && !HoldStandby(settings.standbyTemp, board, runs, 30UL * 60000UL)) {
+      Serial.println("Batch stopped.");
+      break;
+    }
+    Serial.printf("Batch board %d of %d\n", board, runs);
+    if (!StartReflowProfile(profile, true, false)) break;
+
+    cycleMs[completed++] = millis() - boardStartMs;
+    Serial.printf("Board %d cycle time %lus\n", board, cycleMs[completed - 1] / 1000);
+  }
+
+  // Summary: per-board cycle times and totals
+  unsigned long totalMs = millis() - batchStartMs;
+  gfx.fillScreen(Black);
+  gfx.setTextFont(0);
+  gfx.setTextSize(1);
+  gfx.setTextColor(TFT_BLUE, TFT_BLACK);
+  gfx.setCursor(0, 0);
+  gfx.printf("Batch: %d of %d boards\n", completed, runs);
+  for (int i = 0; i < completed && i < 10; ++i) {
+    gfx.printf(" #%d %lum%02lus\n", i + 1, cycleMs[i] / 60000, (cycleMs[i] / 1000) % 60);
+  }
+  gfx.printf("Total %lum%02lus", totalMs / 60000, (totalMs / 1000) % 60);
+  if (completed > 0) {
+    unsigned long avgMs = totalMs / completed;
+    gfx.printf(" avg %lum%02lus", avgMs / 60000, (avgMs / 1000) % 60);
+  }
+  Serial.printf("Batch complete: %d of %d boards in %lus\n", completed, runs, totalMs / 1000);
+  for (int i = 0; i < completed; ++i) {
+    Serial.printf("  Board %d: %lus\n", i + 1, cycleMs[i] / 1000);
+  }
+  WaitForButtonPress(60UL * 60000UL);
 }
 
-void WriteTemp(float temp, float settemp, bool isEditing)
+void WriteTemp(FixedTemp temp, float settemp, bool isEditing)
 {
+    char text[16];
+    FastFormat oven(text, sizeof(text));
     gfx.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
     
-    gfx.printf("Oven:%.0fc/", temp);
+    oven.str("Oven:").temp(temp, 0).str("c/");
+    gfx.print(text);
     if (isEditing) {
             gfx.setTextColor(TFT_BLUE, TFT_BLACK);
 
     } else {
             gfx.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
     }
-    gfx.printf("%.0fc ", settemp);   
+    FastFormat set(text, sizeof(text));
+    set.decimal(settemp, 0).str("c ");
+    gfx.print(text);
 }
 
 void WriteTime(int setTimeMins, bool isEditing)
@@ -223,15 +579,18 @@ void WriteTime(int setTimeMins, bool isEditing)
         gfx.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
     }
     if (setTimeMins == -1) {
-        gfx.printf("Off");
+        gfx.print("Off");
     } else {
+        char text[16];
+        FastFormat timer(text, sizeof(text));
         int hrs = setTimeMins / 60;
         int mins = setTimeMins % 60;
         if (hrs > 0) {
-            gfx.printf("%d:%02d    ", hrs, mins);
+            timer.integer(hrs).chr(':').integer(mins, 2, '0').spaces(4);
         } else {
-            gfx.printf("%dm    ", mins);
+            timer.integer(mins).chr('m').spaces(4);
         }
+        gfx.print(text);
     }
 }
 
@@ -248,18 +607,18 @@ void StartOven() {
     //oven.setGraphLimits(setTemp + 25, setTimeMins);
     oven.initGraph(gfx, 0, 14, GFX_WIDTH-1, GFX_HEIGHT-14, 50.0, 5);
     unsigned long readtime = millis();
+    ControlSample sample = {};
   
     enum EditMode { NONE, TEMP, TIME };
     EditMode editMode = NONE;
     long lastEncoder = rotaryEncoder.readEncoder();
 
     // --- PID and ElementPWM setup ---
+    SetSensorMode(SENSOR_QUIET); // Holding a temperature, so favour low noise
     InitPID();
     ElementPWM elementPWM(mainElement, fryerElement, 1000); // 1Hz PWM
-    uint8_t PWMMain = 0;
-    uint8_t PWMFryer = 0;
 
-    digitalWrite(fan, 1); // Turn on the fan
+    cooling.setFanDuty(100); // Turn on the fan
 
     unsigned long timerEndMs = 0;
     bool timerActive = true;
@@ -280,28 +639,39 @@ void StartOven() {
 
         if (elapsed > 250) {
             readtime = now;
-            temp = GetFilteredTemp(ReadTemp(false));
+            temp = ReadTemp(false);
+            if (!TempValid()) {
+                elementPWM.off();
+                SetHeaterInput(0);
+                ReportSensorFailure();
+                WaitForButtonPress(60UL * 60000UL);
+                gfx.setTextFont(2);
+                return;
+            }
 
             // --- PID control logic ---
             SetPIDTargetTemp(setTemp);
             float pidOutput = GetPIDOutput(temp);
             pidOutput = constrain(pidOutput, 0, 100);
 
-            if (pidOutput > 50) {
-                PWMMain = 100;
-                PWMFryer = constrain((pidOutput - 50) * 2, 0, 100);
-            } else {
-                PWMMain = constrain(pidOutput * 2, 0, 100);
-                PWMFryer = 0;
-            }
-            elementPWM.setPWM(PWMMain, PWMFryer);
+            PowerAllocator::Allocation power = powerAllocator.allocate(pidOutput);
+            elementPWM.setPWM(power.mainPWM, power.fryPWM, power.fryOffset);
+            SetHeaterInput(pidOutput);
+
+            sample.temp = ControlTemp();
+            sample.setpoint = setTemp;
+            sample.rate = TempRate();
+            sample.output = pidOutput;
+            sample.mainPWM = power.mainPWM;
+            sample.fryPWM = power.fryPWM;
+            SampleProbes(sample);
 
             // Write out to the serial monitor the temp, settemp, pid output, and PID components
             if (timerActive && msLeft == 0) {
                 Serial.println("Timer expired, stopping heat.");
                 timerActive = false;
-                elementPWM.setPWM(0, 0);
-                elementPWM.process();
+                elementPWM.off();
+                SetHeaterInput(0);
                 break; // Exit the loop if timer expired
             }
             // Serial.printf(
@@ -309,14 +679,15 @@ void StartOven() {
             //     temp, setTemp, pidOutput, minsLeft,
             //     myPID.GetLastP(), myPID.GetLastI(), myPID.GetLastD()
             //);
+
+            oven.updateGraph(sample);
         }
-        oven.updateGraph(temp, setTemp);
         // Regularly update the PWM outputs
         elementPWM.process();
 
         gfx.setTextSize(1);
         gfx.setCursor(0, 0);
-        WriteTemp(temp, setTemp, editMode == TEMP);
+        WriteTemp(DisplayTemp(), setTemp, editMode == TEMP);
         if( editMode == TIME) {
           WriteTime(setTimeMins, true);
         } else {
@@ -371,10 +742,8 @@ void StartOven() {
         // Break if timer is active and expired
         if (timerActive && msLeft == 0) {
             Serial.println("Oven timer expired. Stopping heat.");
-            elementPWM.setPWM(0, 0);
-            elementPWM.process();
-            digitalWrite(mainElement, 0); // Turn off the main element
-            digitalWrite(fryerElement, 0); // Turn off the fryer element  
+            elementPWM.off();
+            SetHeaterInput(0);
             
             gfx.setTextColor(TFT_BLUE, TFT_BLACK);
             gfx.setCursor(0, 0);
@@ -387,20 +756,17 @@ void StartOven() {
 }
 
 void loop() {
-  static char textBuffer[50];
-
   menuLoop(rotaryEncoder);
-  gfx.setTextColor(TFT_RED, TFT_BLACK);
-  gfx.setTextFont(1);
-  gfx.setTextSize(1);
-  gfx.setTextDatum(TR_DATUM);
-  snprintf(textBuffer, sizeof(textBuffer), "  %.0fC", GetFilteredTemp(ReadTemp(true)));
-  gfx.drawString(textBuffer, 159, 8);
- 
-//  gfx.printf("  %.0fC", GetFilteredTemp(ReadTemp(true)));
-  gfx.setTextFont(2);
-  gfx.setTextDatum(TL_DATUM);
-  
+  saveSettingsWhenIdle();
+  // Don't wait for a reading: the menu stays responsive between samples
+  ReadTemp();
+  // The readout only changes with a new sample, so only then is it worth an
+  // SPI transfer. That also repaints it after the menu has drawn over it.
+  static uint32_t drawnSample;
+  if (TempSampleCount() != drawnSample) {
+    drawnSample = TempSampleCount();
+    DrawIdleReadout();
+  }
 }
 
 bool WaitForButtonPress(unsigned long timeoutMs) {
@@ -410,7 +776,7 @@ bool WaitForButtonPress(unsigned long timeoutMs) {
       // Timeout reached, return false
       return false;
     }
-    delay(100);
+    delay(10);
   }
   return true;
 } 
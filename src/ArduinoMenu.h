@@ -6,6 +6,12 @@ extern TFT_eSPI gfx;
 void setup();
 void loop();
 void IRAM_ATTR readEncoderISR();
-void StartReflowProfile(ReflowProfile& profile);
+// Returns false if the reflow was aborted
+bool StartReflowProfile(ReflowProfile& profile, bool warmStart = false, bool waitAtEnd = true);
+void StartReflowBatch(ReflowProfile& profile);
+bool HoldStandby(int standbyTemp, int board, int runs, unsigned long timeoutMs);
 void StartOven();
+void LogProbes();
+// Writes the last recorded run to serial as CSV
+void DumpLastRun();
 bool WaitForButtonPress(unsigned long timeoutMs = 60000);
@@ -0,0 +1,37 @@
+#include "BootProfiler.h"
+#include "FastFormat.h"
+
+BootProfiler::BootProfiler()
+    : count(0), lock(portMUX_INITIALIZER_UNLOCKED)
+{}
+
+void BootProfiler::record(const char* name, uint32_t startUs) {
+    uint32_t endUs = micros();
+    const char* task = pcTaskGetName(nullptr);
+    portENTER_CRITICAL(&lock);
+    if (count < MAX_STEPS) {
+        steps[count++] = {name, task, startUs, endUs};
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+void BootProfiler::report(Print& out) {
+    portENTER_CRITICAL(&lock);
+    uint8_t n = count;
+    portEXIT_CRITICAL(&lock);
+
+    char line[64];
+    uint32_t lastUs = 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        const Step& s = steps[i];
+        FastFormat text(line, sizeof(line));
+        text.str("Boot ").fixed(s.startUs / 100, 1, 7).str("ms +")
+            .fixed((s.endUs - s.startUs) / 100, 1, 6).str("ms ").str(s.name)
+            .str(" [").str(s.task).str("]\n");
+        out.print(line);
+        if (s.endUs > lastUs) lastUs = s.endUs;
+    }
+    FastFormat text(line, sizeof(line));
+    text.str("Boot ready at ").fixed(lastUs / 100, 1).str("ms\n");
+    out.print(line);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Timestamps the steps of startup so slow ones show up on the serial log.
+// Steps can be recorded from any task; each is tagged with the task that
+// ran it, so work moved off the main task shows up as overlapping.
+class BootProfiler {
+public:
+    static const uint8_t MAX_STEPS = 16;
+
+    BootProfiler();
+
+    // Start time of a step, to pass to record()
+    static uint32_t now() { return micros(); }
+    // Records a step that ran from startUs until now
+    void record(const char* name, uint32_t startUs);
+    // One line per step: start and length in ms since reset, and the task
+    void report(Print& out);
+
+private:
+    struct Step {
+        const char* name;
+        const char* task;
+        uint32_t startUs;
+        uint32_t endUs;
+    };
+
+    Step steps[MAX_STEPS];
+    uint8_t count;
+    portMUX_TYPE lock;
+};
@@ -0,0 +1,281 @@
+#include "Chart.h"
+#include "FastFormat.h"
+
+#define GRID_MAJOR  TFT_NAVY
+#define GRID_MINOR  0x0008
+
+// Value grid steps (degrees) by the axis range
+struct ValueTicks { int32_t minRange; int32_t minor, major; };
+static const ValueTicks valueTicks[] = {
+    {200, 50, 100},
+    {100, 25, 50},
+    {  0, 10, 50},
+};
+
+// Time grid steps (seconds) by span: about 5-15 minor lines
+struct TimeTicks { uint32_t maxSpanS; uint32_t minor, major; };
+static const TimeTicks secondTicks[] = {
+    {15 * 60, 60, 120},
+};
+static const TimeTicks minuteTicks[] = {
+    {15 * 60,          60,      5 * 60},
+    {60 * 60 - 1,      5 * 60,  10 * 60},
+    {120 * 60,         10 * 60, 30 * 60},
+    {5 * 60 * 60 - 1,  30 * 60, 60 * 60},
+    {UINT32_MAX,       60 * 60, 180 * 60},
+};
+
+Chart::Chart()
+    : tft(nullptr), x(0), y(0), w(0), h(0),
+      numSeries(0), numLayers(0), redrawing(false),
+      minTenths(0), maxTenths(1000), timeSpanMs(60000UL),
+      xScale(0), yScale(0), pctScale(0)
+{
+    timeAxis = {60000UL, CLIP, 60000UL, LABEL_MINUTES};
+    valueAxis = {0, 1000, CLIP, 0, 0, ""};
+}
+
+void Chart::begin(TFT_eSPI& display, int gx, int gy, int gw, int gh) {
+    tft = &display;
+    x = gx;
+    y = gy;
+    w = gw;
+    h = gh;
+    numSeries = 0;
+    numLayers = 0;
+    updateScale();
+}
+
+void Chart::setTimeAxis(const TimeAxis& axis) {
+    timeAxis = axis;
+    timeSpanMs = axis.spanMs;
+    updateScale();
+}
+
+void Chart::setValueAxis(const ValueAxis& axis) {
+    valueAxis = axis;
+    minTenths = axis.min;
+    maxTenths = axis.max;
+    updateScale();
+}
+
+void Chart::setLimits(int32_t minValue, int32_t maxValue, uint32_t spanMs) {
+    minTenths = minValue;
+    maxTenths = maxValue;
+    timeSpanMs = spanMs;
+    updateScale();
+}
+
+int8_t Chart::addSeries(uint16_t color, Axis axis) {
+    if (numSeries >= MAX_SERIES) return -1;
+    Series& s = series[numSeries];
+    s.color = color;
+    s.axis = axis;
+    s.hasLast = false;
+    return numSeries++;
+}
+
+bool Chart::addLayer(Layer layer, void* context) {
+    if (numLayers >= MAX_LAYERS) return false;
+    layers[numLayers].layer = layer;
+    layers[numLayers].context = context;
+    numLayers++;
+    return true;
+}
+
+void Chart::updateScale() {
+    if (maxTenths <= minTenths) maxTenths = minTenths + 10;
+    if (timeSpanMs < 1000) timeSpanMs = 1000;
+    if (w < 2 || h < 2) return;
+    // Limits map onto the first and last pixel inside the rectangle; round
+    // the factors up so the far limit isn't truncated a pixel short
+    int32_t range = maxTenths - minTenths;
+    xScale = (((uint64_t)(w - 1) << 32) + timeSpanMs - 1) / timeSpanMs;
+    yScale = (((int32_t)(h - 1) << 16) + range - 1) / range;
+    pctScale = (((int32_t)(h - 1) << 16) + 999) / 1000;
+}
+
+int Chart::timeToX(uint32_t timeMs) const {
+    return x + (int)(((uint64_t)timeMs * xScale) >> 32);
+}
+
+int Chart::valueToY(int32_t tenths) const {
+    return y + h - 1 - (int)(((int64_t)(tenths - minTenths) * yScale) >> 16);
+}
+
+int Chart::percentToY(int32_t tenths) const {
+    tenths = constrain(tenths, 0, 1000);
+    return y + h - 1 - (int)((tenths * pctScale) >> 16);
+}
+
+bool Chart::inside(int px, int py) const {
+    return px >= x && px < x + w && py >= y && py < y + h;
+}
+
+bool Chart::fit(uint32_t timeMs, const int32_t* tenths) {
+    bool changed = false;
+    if (timeAxis.overflow == EXTEND && timeMs >= timeSpanMs) {
+        uint32_t step = timeAxis.stepMs ? timeAxis.stepMs : timeSpanMs;
+        timeSpanMs = (timeMs / step + 1) * step;
+        changed = true;
+    }
+    if (tenths && valueAxis.overflow == EXTEND) {
+        int32_t headroom = valueAxis.headroom;
+        int32_t step = valueAxis.step;
+        if (*tenths > maxTenths) {
+            maxTenths = *tenths + headroom;
+            if (step > 0) maxTenths = ((maxTenths + step - 1) / step) * step;
+            changed = true;
+        }
+        if (*tenths < minTenths) {
+            minTenths = *tenths - headroom;
+            if (step > 0) minTenths = -(((-minTenths) + step - 1) / step) * step;
+            changed = true;
+        }
+    }
+    if (changed) updateScale();
+    return changed;
+}
+
+void Chart::plot(int8_t id, uint32_t timeMs, int32_t value) {
+    if (!tft || id < 0 || id >= numSeries) return;
+    Series& s = series[id];
+    int py;
+    if (s.axis == AXIS_VALUE) {
+        if (!redrawing && fit(timeMs, &value)) redraw();
+        py = valueToY(value);
+    } else {
+        if (!redrawing && fit(timeMs, nullptr)) redraw();
+        py = percentToY(value);
+    }
+    int px = timeToX(timeMs);
+    if (!inside(px, py)) {
+        s.hasLast = false;
+        return;
+    }
+    if (s.hasLast) {
+        tft->drawLine(s.lastX, s.lastY, px, py, s.color);
+    } else {
+        tft->drawPixel(px, py, s.color);
+    }
+    s.lastX = px;
+    s.lastY = py;
+    s.hasLast = true;
+}
+
+void Chart::point(uint32_t timeMs, int32_t value, uint16_t color) {
+    if (!tft) return;
+    int px = timeToX(timeMs);
+    int py = valueToY(value);
+    if (inside(px, py)) tft->drawPixel(px, py, color);
+}
+
+void Chart::bar(uint32_t timeMs, int32_t lo, int32_t hi, uint16_t color) {
+    if (!tft) return;
+    int px = timeToX(timeMs);
+    if (px < x || px >= x + w) return;
+    int top = constrain(valueToY(hi), y, y + h - 1);
+    int bottom = constrain(valueToY(lo), y, y + h - 1);
+    if (bottom > top) tft->drawFastVLine(px, top, bottom - top + 1, color);
+}
+
+void Chart::level(int32_t value, uint16_t color) {
+    if (!tft) return;
+    int py = valueToY(value);
+    if (py >= y && py < y + h) tft->drawFastHLine(x, py, w, color);
+}
+
+void Chart::marker(uint32_t timeMs, int32_t value, uint16_t color, uint8_t size) {
+    if (!tft) return;
+    int px = timeToX(timeMs);
+    int py = valueToY(value);
+    if (inside(px, py)) tft->drawRect(px - size / 2, py - size / 2, size, size, color);
+}
+
+void Chart::breakLine(int8_t id) {
+    if (id >= 0 && id < numSeries) series[id].hasLast = false;
+}
+
+void Chart::breakLines() {
+    for (uint8_t i = 0; i < numSeries; ++i) series[i].hasLast = false;
+}
+
+void Chart::redraw() {
+    if (!tft || w < 2 || h < 2) return;
+    // Layers plot through the normal calls; don't let them extend the axes
+    redrawing = true;
+    tft->fillRect(x, y, w, h, TFT_BLACK);
+    drawGrid();
+    breakLines();
+    for (uint8_t i = 0; i < numLayers; ++i) {
+        layers[i].layer(*this, layers[i].context);
+    }
+    redrawing = false;
+}
+
+void Chart::drawGrid() {
+    char label[12];
+    tft->setTextSize(1);
+    tft->setTextColor(GRID_MAJOR, TFT_BLACK);
+
+    // Horizontal lines on the value axis, labelled on the major steps
+    int32_t lo = minTenths / 10;
+    int32_t hi = maxTenths / 10;
+    const ValueTicks* vt = valueTicks;
+    while (hi - lo < vt->minRange) ++vt;
+    int32_t first = (lo / vt->minor) * vt->minor;
+    if (first <= lo) first += vt->minor;
+    tft->setTextDatum(TL_DATUM);
+    for (int32_t v = first; v <= hi; v += vt->minor) {
+        int py = valueToY(v * 10);
+        if ((v % vt->major) == 0) {
+            tft->drawFastHLine(x, py, w, GRID_MAJOR);
+            if (v > 0 && py + 11 < y + h) {
+                FastFormat text(label, sizeof(label));
+                text.integer(v).str(valueAxis.unit);
+                tft->drawString(label, x + 3, py + 3);
+            }
+        } else {
+            tft->drawFastHLine(x, py, w, GRID_MINOR);
+        }
+    }
+
+    // Vertical lines on the time axis, labelled along the bottom
+    uint32_t spanS = timeSpanMs / 1000;
+    const TimeTicks* tt = minuteTicks;
+    if (timeAxis.labels == LABEL_SECONDS && spanS <= secondTicks[0].maxSpanS) {
+        tt = secondTicks;
+    } else {
+        while (spanS > tt->maxSpanS) ++tt;
+    }
+    tft->setTextDatum(BR_DATUM);
+    for (uint32_t sec = tt->minor; sec <= spanS; sec += tt->minor) {
+        int px = timeToX(sec * 1000UL);
+        if (px >= x + w - 1) break;
+        if ((sec % tt->major) == 0) {
+            tft->drawFastVLine(px, y, h, GRID_MAJOR);
+            FastFormat text(label, sizeof(label));
+            if (tt == secondTicks) {
+                text.integer(sec).chr('s');
+            } else if ((sec / 60) % 60 == 0) {
+                text.integer(sec / 3600).chr('h');
+            } else {
+                text.integer((sec / 60) % 60);
+            }
+            tft->drawString(label, px - 1, y + h - 3);
+        } else {
+            tft->drawFastVLine(px, y, h, GRID_MINOR);
+        }
+    }
+
+    // The percent axis has a fixed scale, so just mark its top
+    for (uint8_t i = 0; i < numSeries; ++i) {
+        if (series[i].axis == AXIS_PERCENT) {
+            tft->setTextDatum(TR_DATUM);
+            tft->drawString("100%", x + w - 2, y + 2);
+            break;
+        }
+    }
+    tft->setTextDatum(TL_DATUM);
+    tft->drawRect(x, y, w, h, GRID_MAJOR);
+}
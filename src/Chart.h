@@ -0,0 +1,124 @@
+#pragma once
+
+#include <TFT_eSPI.h>
+#include <stdint.h>
+#include <math.h>
+
+// Time/value line chart in a rectangle of the display. Time runs along x in
+// ms from the chart's origin; each series is plotted against either the
+// value axis or a fixed 0-100 % axis spanning the full height. Values are
+// integers in tenths of the axis unit (0.1C, 0.1 %) all the way to the pixel.
+//
+// Each axis has an overflow policy: points past a CLIP axis aren't drawn,
+// while an EXTEND axis grows to fit them and the chart redraws. Pixel
+// transforms are multiply-shift factors recomputed only when limits change.
+//
+// A redraw clears the rectangle, draws the grid, then calls the registered
+// layers in order (e.g. a reference curve, then recorded history). Between
+// redraws, live points are drawn incrementally.
+//
+// Layer output isn't cached. A redraw follows a change of limits, which
+// moves every pixel a layer drew, or a return to the screen. The layers
+// already replay from compact value-space data (the profile trajectory,
+// runHistory), and a pixel cache of the plot area would cost ~36 KB of heap
+// to save work that is mostly the SPI transfer it would still need.
+class Chart {
+public:
+    enum Overflow { CLIP, EXTEND };
+    enum TimeLabels { LABEL_SECONDS, LABEL_MINUTES };
+    enum Axis { AXIS_VALUE, AXIS_PERCENT };
+
+    struct TimeAxis {
+        uint32_t spanMs;
+        Overflow overflow;
+        uint32_t stepMs;      // An extended span is a multiple of this
+        TimeLabels labels;
+    };
+    // Limits, headroom and step in tenths
+    struct ValueAxis {
+        int32_t min, max;
+        Overflow overflow;
+        int32_t headroom;     // Left beyond a point that extends the axis
+        int32_t step;         // Extended limits round out to a multiple of this (0 = exact)
+        const char* unit;     // Label suffix, e.g. "c"
+    };
+    typedef void (*Layer)(Chart& chart, void* context);
+
+    static const uint8_t MAX_SERIES = 12;
+    static const uint8_t MAX_LAYERS = 4;
+
+    Chart();
+    // Also clears any series and layers from a previous use
+    void begin(TFT_eSPI& tft, int x, int y, int w, int h);
+    void setTimeAxis(const TimeAxis& axis);
+    void setValueAxis(const ValueAxis& axis);
+    // Changes the limits (tenths) but not the policies; call redraw() to show them
+    void setLimits(int32_t minValue, int32_t maxValue, uint32_t spanMs);
+    // Returns the series id, or -1 when full. Series draw in the order added.
+    int8_t addSeries(uint16_t color, Axis axis);
+    bool addLayer(Layer layer, void* context);
+
+    // Plots the next point of a series, joined to its previous one. A point
+    // past an EXTEND axis redraws the chart on the new limits first.
+    void plot(int8_t series, uint32_t timeMs, int32_t value);
+    // Single pixel on the value axis, not joined or fitted
+    void point(uint32_t timeMs, int32_t value, uint16_t color);
+    // Vertical bar on the value axis, e.g. a min-max envelope
+    void bar(uint32_t timeMs, int32_t lo, int32_t hi, uint16_t color);
+    // Horizontal line across the chart at a value
+    void level(int32_t value, uint16_t color);
+    // Hollow square of size pixels centred on a value-axis point
+    void marker(uint32_t timeMs, int32_t value, uint16_t color, uint8_t size = 3);
+    // Starts a series afresh at its next point instead of joining to its
+    // last one, e.g. across a gap in its readings
+    void breakLine(int8_t series);
+    // breakLine() for every series
+    void breakLines();
+    void redraw();
+
+    int32_t minValue() const { return minTenths; }
+    int32_t maxValue() const { return maxTenths; }
+    uint32_t spanMs() const { return timeSpanMs; }
+    int timeToX(uint32_t timeMs) const;
+    int valueToY(int32_t tenths) const;
+    int percentToY(int32_t tenths) const;
+
+    // Rounds a float reading to the tenths the chart takes
+    static int32_t tenths(float value) { return (int32_t)lroundf(value * 10.0f); }
+
+private:
+    struct Series {
+        uint16_t color;
+        Axis axis;
+        bool hasLast;
+        int16_t lastX, lastY;
+    };
+    struct LayerEntry {
+        Layer layer;
+        void* context;
+    };
+
+    TFT_eSPI* tft;
+    int x, y, w, h;
+    TimeAxis timeAxis;
+    ValueAxis valueAxis;
+    Series series[MAX_SERIES];
+    uint8_t numSeries;
+    LayerEntry layers[MAX_LAYERS];
+    uint8_t numLayers;
+    bool redrawing;
+
+    // Limits, with values held in tenths
+    int32_t minTenths, maxTenths;
+    uint32_t timeSpanMs;
+    // Transforms: x = (t * xScale) >> 32, y = (tenths * yScale) >> 16 on either axis
+    uint64_t xScale;
+    int32_t yScale;
+    int32_t pctScale;
+
+    void updateScale();
+    // Applies the overflow policies to a point; returns true if limits changed
+    bool fit(uint32_t timeMs, const int32_t* tenths);
+    bool inside(int px, int py) const;
+    void drawGrid();
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include "FixedTemp.h"
+
+// One control tick's worth of state, shared by everything that records or
+// streams a run
+struct ControlSample {
+    static const uint8_t MAX_PROBES = 4;
+    // probes[] entry for a probe that isn't fitted or is faulted
+    static const FixedTemp NO_READING = INT32_MIN;
+    // The same, once scaled to tenths of C for history, recording and telemetry
+    static const int16_t NO_READING_TENTHS = INT16_MIN;
+
+    uint32_t timeMs;       // Profile time
+    FixedTemp temp;        // Control temperature
+    float setpoint;        // C
+    float rate;            // Estimated C/s
+    float p, i, d;         // PID terms, % output
+    float feedForward;     // %
+    float output;          // Final demand 0-100 %
+    uint8_t mainPWM;       // Element duty split, %
+    uint8_t fryPWM;
+    uint8_t fanDuty;       // %
+    uint8_t phase;
+    bool sensorFault;      // Every probe failed; the heat was cut and the run stopped
+    // Individual probes, only filled in when more than one is fitted
+    FixedTemp probes[MAX_PROBES];
+
+    static int16_t probeTenths(FixedTemp probe) {
+        if (probe == NO_READING) return NO_READING_TENTHS;
+        int32_t tenths = fixedToTenths(probe);
+        return (int16_t)(tenths < -32767 ? -32767 : (tenths > 32767 ? 32767 : tenths));
+    }
+};
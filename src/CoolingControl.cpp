@@ -0,0 +1,64 @@
+#include "CoolingControl.h"
+
+CoolingController::CoolingController(const Config& config)
+    : _config(config), _duty(0), _integral(0), _rate(0), _lastMs(0),
+      _shortSinceMs(0), _running(false), _doorPrompt(false)
+{}
+
+void CoolingController::begin() {
+    ledcSetup(_config.channel, _config.freqHz, 8);
+    ledcAttachPin(_config.pin, _config.channel);
+    setFanDuty(0);
+}
+
+void CoolingController::reset() {
+    _integral = 0;
+    _rate = 0;
+    _running = false;
+    _shortSinceMs = 0;
+    _doorPrompt = false;
+}
+
+void CoolingController::setFanDuty(uint8_t pct) {
+    _duty = constrain(pct, 0, 100);
+    ledcWrite(_config.channel, (uint32_t)_duty * 255 / 100);
+}
+
+uint8_t CoolingController::update(uint32_t nowMs, float temp, float rate, float setpoint, float targetRate) {
+    _rate = rate;
+    if (!_running) {
+        // First tick: start from the fan's current speed
+        _running = true;
+        _lastMs = nowMs;
+        _integral = _duty;
+        return _duty;
+    }
+
+    float dt = (nowMs - _lastMs) / 1000.0f;
+    if (dt <= 0) return _duty;
+    _lastMs = nowMs;
+
+    // Cool faster than the ramp when above it, slower when below
+    float wantRate = targetRate - _config.kpos * (temp - setpoint);
+    // Positive error = not cooling fast enough = more fan
+    float error = _rate - wantRate;
+
+    float out = _integral + _config.kp * error;
+    float newIntegral = _integral + _config.ki * error * dt;
+    // Only integrate while the output isn't pinned in the direction of the error
+    if (!((out >= 100 && error > 0) || (out <= _config.minDuty && error < 0))) {
+        _integral = constrain(newIntegral, (float)_config.minDuty, 100.0f);
+    }
+    out = constrain(out, (float)_config.minDuty, 100.0f);
+    setFanDuty((uint8_t)(out + 0.5f));
+
+    // Flat out and still short of the required rate for a while: the fan alone can't do it
+    if (_duty >= 100 && error > _config.doorMarginCPerS) {
+        if (_shortSinceMs == 0) _shortSinceMs = nowMs;
+        _doorPrompt = (nowMs - _shortSinceMs) >= _config.doorDelayMs;
+    } else {
+        _shortSinceMs = 0;
+        _doorPrompt = false;
+    }
+    return _duty;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Variable-speed fan on an LEDC PWM channel, plus a controller that sets the
+// fan speed to follow a cool-down ramp. If the fan is flat out and the oven is
+// still cooling too slowly, it asks for the door to be opened.
+class CoolingController {
+public:
+    struct Config {
+        uint8_t pin;
+        uint8_t channel;          // LEDC channel
+        uint32_t freqHz;
+        float kp;                 // Fan % per C/s of rate error
+        float ki;                 // Fan % per C/s of rate error per second
+        float kpos;               // Extra C/s of cooling asked for per C above setpoint
+        uint8_t minDuty;          // Fan never drops below this while cooling
+        float doorMarginCPerS;    // Shortfall in cooling rate that counts as "can't keep up"
+        uint32_t doorDelayMs;     // How long the fan must be flat out and short before prompting
+    };
+
+    CoolingController(const Config& config);
+    void begin();
+    void reset();
+
+    // Direct fan speed, 0-100 %, e.g. full for convection while heating
+    void setFanDuty(uint8_t pct);
+    uint8_t fanDuty() const { return _duty; }
+
+    // Runs the rate controller for one tick; rate is the oven's measured
+    // C/s and targetRate the ramp's (both negative when cooling). Returns
+    // the fan duty applied.
+    uint8_t update(uint32_t nowMs, float temp, float rate, float setpoint, float targetRate);
+    float measuredRate() const { return _rate; }
+    bool doorOpenNeeded() const { return _doorPrompt; }
+
+private:
+    Config _config;
+    uint8_t _duty;
+    float _integral;
+    float _rate;
+    uint32_t _lastMs;
+    uint32_t _shortSinceMs;
+    bool _running;
+    bool _doorPrompt;
+};
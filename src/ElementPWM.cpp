@@ -1,7 +1,8 @@
 #include "ElementPWM.h"
 
 ElementPWM::ElementPWM(uint8_t mainPin, uint8_t fryPin, uint32_t pwmPeriodMs)
-    : _mainPin(mainPin), _fryPin(fryPin), _pwmPeriodMs(pwmPeriodMs), _mainPWM(0), _fryPWM(0), _mainPWMSet(0), _fryPWMSet(0), _cycleStartMs(0)
+    : _mainPin(mainPin), _fryPin(fryPin), _pwmPeriodMs(pwmPeriodMs), _mainPWM(0), _fryPWM(0), _fryOffset(0),
+      _mainPWMSet(0), _fryPWMSet(0), _fryOffsetSet(0), _mainOn(false), _fryOn(false), _cycleStartMs(0)
 {
     pinMode(_mainPin, OUTPUT);
     pinMode(_fryPin, OUTPUT);
@@ -10,10 +11,11 @@ ElementPWM::ElementPWM(uint8_t mainPin, uint8_t fryPin, uint32_t pwmPeriodMs)
     _cycleStartMs = millis();
 }
 
-void ElementPWM::setPWM(uint8_t mainPWM, uint8_t fryPWM)
+void ElementPWM::setPWM(uint8_t mainPWM, uint8_t fryPWM, uint8_t fryOffset)
 {
     _mainPWM = constrain(mainPWM, 0, 100);
     _fryPWM = constrain(fryPWM, 0, 100);
+    _fryOffset = fryOffset % 100;
 }
 
 void ElementPWM::process()
@@ -26,21 +28,38 @@ void ElementPWM::process()
     if ((now - _cycleStartMs) >= _pwmPeriodMs) {
         _mainPWMSet = _mainPWM;
         _fryPWMSet = _fryPWM;
+        _fryOffsetSet = _fryOffset;
         _cycleStartMs = now;
-        digitalWrite(_mainPin, HIGH);
-        digitalWrite(_fryPin, HIGH);
         delta = 0;
     }
 
     updateOutputs(delta);
 }
 
+void ElementPWM::off()
+{
+    _mainPWM = _fryPWM = 0;
+    _mainPWMSet = _fryPWMSet = 0;
+    digitalWrite(_mainPin, LOW);
+    digitalWrite(_fryPin, LOW);
+    _mainOn = _fryOn = false;
+}
+
 void ElementPWM::updateOutputs(uint32_t delta)
 {
-    if (delta >= _mainPWMSet) {
-        digitalWrite(_mainPin, LOW);
+    // Main runs from the start of the window, fryer from its offset, wrapping
+    // round into the start of the window if it runs past the end
+    bool mainOn = delta < _mainPWMSet;
+    bool fryOn = ((delta + 100 - _fryOffsetSet) % 100) < _fryPWMSet;
+    if (_fryPWMSet >= 100) fryOn = true;
+    if (_mainPWMSet >= 100) mainOn = true;
+
+    if (mainOn != _mainOn) {
+        digitalWrite(_mainPin, mainOn ? HIGH : LOW);
+        _mainOn = mainOn;
     }
-    if (delta >= _fryPWMSet) {
-        digitalWrite(_fryPin, LOW);
+    if (fryOn != _fryOn) {
+        digitalWrite(_fryPin, fryOn ? HIGH : LOW);
+        _fryOn = fryOn;
     }
 }
@@ -5,16 +5,28 @@
 class ElementPWM {
 public:
     ElementPWM(uint8_t mainPin, uint8_t fryPin, uint32_t pwmPeriodMs = 1000);
-    void setPWM(uint8_t mainPWM, uint8_t fryPWM);
+    // Leaving the heating loop's scope turns the elements off too
+    ~ElementPWM() { off(); }
+    // fryOffset shifts the fryer's on-period, in % of the window, so the two
+    // elements can run back-to-back instead of switching on together
+    void setPWM(uint8_t mainPWM, uint8_t fryPWM, uint8_t fryOffset = 0);
     void process();
+    // Drives both elements LOW now and zeroes the duties, including the
+    // cycle in progress. Use on every exit from a heating loop: setPWM(0, 0)
+    // only takes effect at the next cycle, which needs process() calls.
+    void off();
 
 private:
     uint8_t _mainPin;
     uint8_t _fryPin;
     uint8_t _mainPWM;
     uint8_t _fryPWM;
+    uint8_t _fryOffset;
     uint8_t _mainPWMSet;
     uint8_t _fryPWMSet;
+    uint8_t _fryOffsetSet;
+    bool _mainOn;
+    bool _fryOn;
     uint32_t _pwmPeriodMs;
     uint32_t _cycleStartMs;
     void updateOutputs(uint32_t delta);
@@ -0,0 +1,110 @@
+#include "FastFormat.h"
+#include <math.h>
+
+static const uint32_t powersOf10[FastFormat::MAX_DECIMALS + 1] = {1, 10, 100, 1000, 10000};
+
+FastFormat::FastFormat(char* buffer, size_t bufferSize)
+    : buf(buffer), size(bufferSize), len(0)
+{
+    if (size > 0) buf[0] = '\0';
+}
+
+void FastFormat::clear() {
+    len = 0;
+    if (size > 0) buf[0] = '\0';
+}
+
+FastFormat& FastFormat::chr(char c) {
+    if (len + 1 < size) {
+        buf[len++] = c;
+        buf[len] = '\0';
+    }
+    return *this;
+}
+
+FastFormat& FastFormat::str(const char* s) {
+    if (!s) return *this;
+    while (*s && len + 1 < size) buf[len++] = *s++;
+    if (size > 0) buf[len] = '\0';
+    return *this;
+}
+
+FastFormat& FastFormat::spaces(uint8_t n) {
+    while (n-- > 0) chr(' ');
+    return *this;
+}
+
+void FastFormat::number(bool negative, uint32_t magnitude, uint8_t decimals, uint8_t width, char pad, bool plus) {
+    // Digits are generated backwards into a scratch buffer
+    char digits[16];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < decimals; ++i) {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    }
+    if (decimals > 0) digits[n++] = '.';
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    char sign = negative ? '-' : (plus ? '+' : 0);
+    uint8_t total = n + (sign ? 1 : 0);
+    // Zero padding goes between the sign and the digits, spaces before the sign
+    if (pad != '0') {
+        for (uint8_t i = total; i < width; ++i) chr(' ');
+        if (sign) chr(sign);
+    } else {
+        if (sign) chr(sign);
+        for (uint8_t i = total; i < width; ++i) chr('0');
+    }
+    while (n > 0) chr(digits[--n]);
+}
+
+FastFormat& FastFormat::integer(int32_t value, uint8_t width, char pad, bool plus) {
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    number(value < 0, magnitude, 0, width, pad, plus);
+    return *this;
+}
+
+FastFormat& FastFormat::fixed(int32_t scaled, uint8_t decimals, uint8_t width, bool plus) {
+    if (decimals > MAX_DECIMALS) decimals = MAX_DECIMALS;
+    uint32_t magnitude = scaled < 0 ? 0u - (uint32_t)scaled : (uint32_t)scaled;
+    number(scaled < 0, magnitude, decimals, width, ' ', plus);
+    return *this;
+}
+
+FastFormat& FastFormat::decimal(float value, uint8_t decimals, uint8_t width, bool plus) {
+    if (decimals > MAX_DECIMALS) decimals = MAX_DECIMALS;
+    if (isnan(value)) {
+        spaces(width > 3 ? width - 3 : 0);
+        return str("nan");
+    }
+    // Scaled in double, where a float times 10^4 is exact, so the only
+    // rounding is the one to an integer. A float scaled in float rounds
+    // twice and can land a digit off printf (566.1985 gave 566.199).
+    double scaled = (double)value * powersOf10[decimals];
+    // Past int32 range: clamp rather than wrap
+    if (scaled > 2147483647.0) scaled = 2147483647.0;
+    if (scaled < -2147483647.0) scaled = -2147483647.0;
+    return fixed((int32_t)lround(scaled), decimals, width, plus);
+}
+
+FastFormat& FastFormat::temp(FixedTemp value, uint8_t decimals, uint8_t width) {
+    if (decimals > MAX_DECIMALS) decimals = MAX_DECIMALS;
+    // Rounded half away from zero
+    int64_t scaled = (int64_t)value * powersOf10[decimals];
+    int64_t half = FIXED_TEMP_ONE / 2;
+    scaled = (scaled >= 0 ? scaled + half : scaled - half) / FIXED_TEMP_ONE;
+    return fixed((int32_t)scaled, decimals, width);
+}
+
+FastFormat& FastFormat::hex(uint32_t value, uint8_t digits) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    if (digits > 8) digits = 8;
+    if (digits == 0) digits = 1;
+    for (int8_t shift = (digits - 1) * 4; shift >= 0; shift -= 4) {
+        chr(hexDigits[(value >> shift) & 0xF]);
+    }
+    return *this;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "FixedTemp.h"
+
+// Builds text in a caller-supplied buffer without printf: no heap, no
+// varargs and no float formatting code. Appends chain, always leave the
+// buffer terminated, and truncate rather than overrun.
+//
+// Numbers are right-aligned in width characters when width is given (0 =
+// as wide as needed). decimal() rounds a float to a scaled integer first,
+// so the digits themselves are always produced with integer arithmetic.
+// It matches printf("%.*f") except on exact binary ties (e.g. 0.125 to two
+// places), which it rounds half away from zero where printf rounds to even,
+// and a negative value that rounds to zero, which it prints without the '-'.
+class FastFormat {
+public:
+    FastFormat(char* buffer, size_t size);
+
+    FastFormat& str(const char* s);
+    FastFormat& chr(char c);
+    // Appends n spaces, e.g. to blank the rest of an overwritten line
+    FastFormat& spaces(uint8_t n);
+    FastFormat& integer(int32_t value, uint8_t width = 0, char pad = ' ', bool plus = false);
+    // Fixed-point value: scaled is in units of 10^-decimals
+    FastFormat& fixed(int32_t scaled, uint8_t decimals, uint8_t width = 0, bool plus = false);
+    FastFormat& decimal(float value, uint8_t decimals, uint8_t width = 0, bool plus = false);
+    FastFormat& temp(FixedTemp value, uint8_t decimals, uint8_t width = 0);
+    FastFormat& hex(uint32_t value, uint8_t digits);
+
+    const char* c_str() const { return buf; }
+    size_t length() const { return len; }
+    void clear();
+
+    static const uint8_t MAX_DECIMALS = 4;
+
+private:
+    char* buf;
+    size_t size;
+    size_t len;
+
+    // Writes sign, whole part and decimals of |magnitude| right-aligned in width
+    void number(bool negative, uint32_t magnitude, uint8_t decimals, uint8_t width, char pad, bool plus);
+};
@@ -0,0 +1,139 @@
+#include "FilterPipeline.h"
+
+// Extra EMA fraction bits, so small alphas don't stall on rounding
+#define EMA_SHIFT 8
+
+FilterPipeline::FilterPipeline()
+    : count(0), samples(0), output(0)
+{}
+
+FilterPipeline::FilterPipeline(const StageConfig* stages, uint8_t count)
+    : FilterPipeline()
+{
+    configure(stages, count);
+}
+
+bool FilterPipeline::validate(const StageConfig& config) {
+    switch (config.type) {
+    case NONE:
+        return true;
+    case MEDIAN:
+    case MOVING_AVERAGE:
+        return config.param1 >= 1 && config.param1 <= MAX_WINDOW;
+    case EMA:
+        return config.param1 > 0 && config.param1 <= 1;
+    case KALMAN:
+        return config.param1 > 0 && config.param2 > 0;
+    }
+    return false;
+}
+
+bool FilterPipeline::configure(const StageConfig* configs, uint8_t n) {
+    count = 0;
+    for (uint8_t i = 0; i < n && i < MAX_STAGES; ++i) {
+        if (!validate(configs[i])) {
+            reset();
+            return false;
+        }
+        stages[count++].config = configs[i];
+    }
+    reset();
+    return n <= MAX_STAGES;
+}
+
+bool FilterPipeline::setStage(uint8_t index, const StageConfig& config) {
+    if (index > count || index >= MAX_STAGES || !validate(config)) return false;
+    if (index == count) count++;
+    stages[index].config = config;
+    resetStage(stages[index]);
+    return true;
+}
+
+void FilterPipeline::reset() {
+    for (uint8_t i = 0; i < count; ++i) resetStage(stages[i]);
+    samples = 0;
+    output = 0;
+}
+
+void FilterPipeline::resetStage(Stage& stage) {
+    stage.window = (uint8_t)stage.config.param1;
+    stage.head = 0;
+    stage.fill = 0;
+    stage.sum = 0;
+    stage.alpha = (stage.config.type == EMA) ? (int32_t)lroundf(stage.config.param1 * 65536.0f) : 0;
+    stage.average = 0;
+    stage.state = 0;
+    stage.variance = 0;
+}
+
+FixedTemp FilterPipeline::filter(FixedTemp sample) {
+    FixedTemp value = sample;
+    for (uint8_t i = 0; i < count; ++i) {
+        value = run(stages[i], value);
+    }
+    samples++;
+    output = value;
+    return value;
+}
+
+FixedTemp FilterPipeline::run(Stage& s, FixedTemp sample) {
+    switch (s.config.type) {
+    case NONE:
+        return sample;
+
+    case MEDIAN: {
+        s.ring[s.head] = sample;
+        s.head = (s.head + 1) % s.window;
+        if (s.fill < s.window) s.fill++;
+        // Insertion sort of at most MAX_WINDOW values
+        FixedTemp sorted[MAX_WINDOW];
+        for (uint8_t i = 0; i < s.fill; ++i) {
+            FixedTemp key = s.ring[i];
+            int8_t j = i - 1;
+            while (j >= 0 && sorted[j] > key) {
+                sorted[j + 1] = sorted[j];
+                --j;
+            }
+            sorted[j + 1] = key;
+        }
+        return sorted[s.fill / 2];
+    }
+
+    case EMA: {
+        int32_t scaled = sample * (1 << EMA_SHIFT);
+        if (s.fill == 0) {
+            s.average = scaled;
+            s.fill = 1;
+        } else {
+            s.average += (int32_t)(((int64_t)(scaled - s.average) * s.alpha) >> 16);
+        }
+        return (s.average + (1 << (EMA_SHIFT - 1))) >> EMA_SHIFT;
+    }
+
+    case MOVING_AVERAGE:
+        if (s.fill == s.window) s.sum -= s.ring[s.head];
+        else s.fill++;
+        s.ring[s.head] = sample;
+        s.sum += sample;
+        s.head = (s.head + 1) % s.window;
+        // Rounded to nearest
+        return (s.sum >= 0 ? s.sum + s.fill / 2 : s.sum - s.fill / 2) / s.fill;
+
+    case KALMAN: {
+        // Random-walk model: x(k) = x(k-1) + w, z(k) = x(k) + v
+        float z = fixedToC(sample);
+        if (s.fill == 0) {
+            s.state = z;
+            s.variance = s.config.param2;
+            s.fill = 1;
+        } else {
+            s.variance += s.config.param1;
+            float gain = s.variance / (s.variance + s.config.param2);
+            s.state += gain * (z - s.state);
+            s.variance *= (1 - gain);
+        }
+        return toFixedTemp(s.state);
+    }
+    }
+    return sample;
+}
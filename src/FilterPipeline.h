@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+#include "FixedTemp.h"
+
+// Streaming filter built from a short chain of stages, each with fixed
+// storage. Every consumer of the temperature (controller, display) owns its
+// own pipeline so they don't share state. Stages can be reconfigured at run
+// time; doing so resets the affected stage.
+//
+// Samples are FixedTemp. Median, moving average and EMA stay in integers;
+// the Kalman stage works in float C, so its noise parameters are in C^2.
+class FilterPipeline {
+public:
+    enum StageType : uint8_t {
+        NONE,
+        MEDIAN,          // param1 = window (samples, odd)
+        EMA,             // param1 = alpha (0-1]
+        MOVING_AVERAGE,  // param1 = window (samples)
+        KALMAN           // param1 = process noise q, param2 = measurement noise r
+    };
+
+    struct StageConfig {
+        StageType type;
+        float param1;
+        float param2;
+    };
+
+    static const uint8_t MAX_STAGES = 4;
+    static const uint8_t MAX_WINDOW = 9;
+
+    FilterPipeline();
+    FilterPipeline(const StageConfig* stages, uint8_t count);
+
+    // Replaces the whole chain. Returns false if a stage was invalid; the
+    // valid stages before it are kept.
+    bool configure(const StageConfig* stages, uint8_t count);
+    bool setStage(uint8_t index, const StageConfig& config);
+    void reset();
+
+    // Pushes one sample through every stage and returns the output
+    FixedTemp filter(FixedTemp sample);
+    FixedTemp value() const { return output; }
+    bool primed() const { return samples > 0; }
+    uint8_t numStages() const { return count; }
+    const StageConfig& stage(uint8_t i) const { return stages[i].config; }
+
+private:
+    struct Stage {
+        StageConfig config;
+        uint8_t window;
+        FixedTemp ring[MAX_WINDOW];
+        uint8_t head;
+        uint8_t fill;
+        int32_t sum;       // Moving-average running sum
+        int32_t alpha;     // EMA weight, Q16
+        int32_t average;   // EMA state, FixedTemp with 8 extra fraction bits
+        float state;       // Kalman estimate C
+        float variance;    // Kalman error variance
+    };
+
+    Stage stages[MAX_STAGES];
+    uint8_t count;
+    uint32_t samples;
+    FixedTemp output;
+
+    static bool validate(const StageConfig& config);
+    static void resetStage(Stage& stage);
+    static FixedTemp run(Stage& stage, FixedTemp sample);
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <math.h>
+
+// Temperature in fixed point, 1/128 C per count. That's the MAX31856's
+// thermocouple LSB, so a register reading converts with a shift, and the
+// sensor, filter, history, chart and display path stays in integers. Float
+// is only used where the controller needs it.
+typedef int32_t FixedTemp;
+
+#define FIXED_TEMP_ONE 128
+
+inline FixedTemp toFixedTemp(float c) {
+    return (FixedTemp)lroundf(c * FIXED_TEMP_ONE);
+}
+
+inline float fixedToC(FixedTemp t) {
+    return t * (1.0f / FIXED_TEMP_ONE);
+}
+
+// Rounded half away from zero
+inline int32_t fixedToWholeC(FixedTemp t) {
+    return (t >= 0 ? t + FIXED_TEMP_ONE / 2 : t - FIXED_TEMP_ONE / 2) / FIXED_TEMP_ONE;
+}
+
+inline int32_t fixedToTenths(FixedTemp t) {
+    int32_t scaled = t * 10;
+    return (scaled >= 0 ? scaled + FIXED_TEMP_ONE / 2 : scaled - FIXED_TEMP_ONE / 2) / FIXED_TEMP_ONE;
+}
+
+inline FixedTemp fixedFromTenths(int32_t tenths) {
+    int32_t scaled = tenths * FIXED_TEMP_ONE;
+    return (scaled >= 0 ? scaled + 5 : scaled - 5) / 10;
+}
+
+// MAX31856 LTCBH/LTCBM/LTCBL: a 19-bit two's complement reading left
+// justified in 24 bits, LSB 1/128 C
+inline FixedTemp fixedFromRegisters(const uint8_t* ltcb) {
+    int32_t raw = ((uint32_t)ltcb[0] << 24) | ((uint32_t)ltcb[1] << 16) | ((uint32_t)ltcb[2] << 8);
+    return raw >> 13;
+}
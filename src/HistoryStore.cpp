@@ -0,0 +1,276 @@
+#include "HistoryStore.h"
+
+// 1 s, 10 s, 1 min and 5 min buckets. At ~4-6 bytes a bucket that is
+// about 4 minutes, 40 minutes, 4 hours and 20 hours.
+const uint32_t HistoryStore::TIER_BUCKET_MS[NUM_TIERS] = {1000, 10000, 60000, 300000};
+
+// Three bytes per int16 varint: mean delta, two offsets, mask and a delta
+// for each other series
+#define MAX_RECORD_BYTES (3 * 3 + 1 + (NUM_SERIES - 1) * 3)
+
+HistoryStore runHistory;
+
+HistoryStore::HistoryStore() {
+    for (uint8_t t = 0; t < NUM_TIERS; ++t) {
+        tiers[t].bucketMs = TIER_BUCKET_MS[t];
+        tiers[t].buf = storage + t * TIER_BYTES;
+    }
+    reset(0);
+}
+
+void HistoryStore::reset(uint32_t nowMs) {
+    startMs = nowMs;
+    samples = 0;
+    maxSeen = 0;
+    for (uint8_t t = 0; t < NUM_TIERS; ++t) {
+        Tier& tier = tiers[t];
+        tier.head = tier.used = tier.count = 0;
+        tier.firstIdx = 0;
+        tier.accOpen = false;
+    }
+}
+
+static int16_t toTenths(float value) {
+    float tenths = value * 10.0f;
+    if (tenths > 32767) tenths = 32767;
+    if (tenths < -32768) tenths = -32768;
+    return (int16_t)(tenths < 0 ? tenths - 0.5f : tenths + 0.5f);
+}
+
+static int16_t toPercent(float value) {
+    return (int16_t)(value < 0 ? 0 : (value > 100 ? 100 : value + 0.5f));
+}
+
+void HistoryStore::add(uint32_t nowMs, const ControlSample& sample) {
+    Record r;
+    r.value[SERIES_MEAN] = (int16_t)fixedToTenths(sample.temp);
+    r.value[SERIES_SETPOINT] = toTenths(sample.setpoint);
+    r.value[SERIES_OUTPUT] = toPercent(sample.output);
+    r.value[SERIES_MAIN] = toPercent(sample.mainPWM);
+    r.value[SERIES_FRY] = toPercent(sample.fryPWM);
+    r.min = r.max = r.value[SERIES_MEAN];
+
+    int16_t top = r.value[SERIES_MEAN] > r.value[SERIES_SETPOINT] ? r.value[SERIES_MEAN] : r.value[SERIES_SETPOINT];
+    for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+        int16_t probe = ControlSample::probeTenths(sample.probes[i]);
+        r.value[SERIES_PROBE + i] = probe;
+        if (probe != ControlSample::NO_READING_TENTHS && probe > top) top = probe;
+    }
+    if (samples == 0 || top > maxSeen) maxSeen = top;
+    samples++;
+    accumulate(0, (nowMs - startMs) / tiers[0].bucketMs, r);
+}
+
+void HistoryStore::accumulate(uint8_t t, uint32_t idx, const Record& r) {
+    Tier& tier = tiers[t];
+    if (tier.accOpen && idx != tier.accIdx) close(t);
+    if (!tier.accOpen) {
+        tier.accOpen = true;
+        tier.accIdx = idx;
+        tier.accMin = r.min;
+        tier.accMax = r.max;
+        for (uint8_t s = 0; s < NUM_SERIES; ++s) {
+            tier.accSum[s] = 0;
+            tier.accN[s] = 0;
+        }
+    }
+    if (r.min < tier.accMin) tier.accMin = r.min;
+    if (r.max > tier.accMax) tier.accMax = r.max;
+    for (uint8_t s = 0; s < NUM_SERIES; ++s) {
+        // Probes without a reading are left out of the mean
+        if (r.value[s] == ControlSample::NO_READING_TENTHS) continue;
+        tier.accSum[s] += r.value[s];
+        tier.accN[s]++;
+    }
+}
+
+int16_t HistoryStore::mean(const Tier& tier, uint8_t s) {
+    if (tier.accN[s] == 0) return ControlSample::NO_READING_TENTHS;
+    return (int16_t)(tier.accSum[s] / (int32_t)tier.accN[s]);
+}
+
+void HistoryStore::close(uint8_t t) {
+    Tier& tier = tiers[t];
+    tier.accOpen = false;
+    Record r;
+    r.min = tier.accMin;
+    r.max = tier.accMax;
+    for (uint8_t s = 0; s < NUM_SERIES; ++s) r.value[s] = mean(tier, s);
+    append(t, tier.accIdx, r);
+    if (t + 1 < NUM_TIERS) {
+        uint32_t ratio = tiers[t + 1].bucketMs / tier.bucketMs;
+        accumulate(t + 1, tier.accIdx / ratio, r);
+    }
+}
+
+static uint8_t putVarint(uint32_t v, uint8_t* out) {
+    uint8_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+static inline uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+// Record: zigzag mean delta, min offset, max offset, then a mask of which
+// other series changed and a zigzag delta for each of those
+void HistoryStore::append(uint8_t t, uint32_t idx, const Record& r) {
+    Tier& tier = tiers[t];
+    if (tier.count > 0 && idx > tier.firstIdx + tier.count) {
+        uint32_t missing = idx - (tier.firstIdx + tier.count);
+        if (missing >= TIER_BYTES / 4) {
+            // A hold record takes at least 4 bytes, so filling this gap would
+            // evict everything before it anyway: restart the tier at idx
+            tier.count = 0;
+        } else {
+            // Gap with no samples: hold the last values flat across it. Each
+            // hold lands straight after the tail, so these don't recurse.
+            Record hold;
+            for (uint8_t s = 0; s < NUM_SERIES; ++s) hold.value[s] = tier.tailValue[s];
+            hold.min = hold.max = hold.value[SERIES_MEAN];
+            for (uint32_t i = 0; i < missing; ++i) {
+                append(t, idx - missing + i, hold);
+            }
+        }
+    }
+
+    int32_t delta[NUM_SERIES];
+    for (uint8_t s = 0; s < NUM_SERIES; ++s) {
+        delta[s] = (tier.count == 0) ? 0 : (int32_t)r.value[s] - tier.tailValue[s];
+    }
+    uint8_t rec[MAX_RECORD_BYTES];
+    uint8_t len = putVarint(zigzag(delta[SERIES_MEAN]), rec);
+    len += putVarint((uint32_t)(r.value[SERIES_MEAN] - r.min), rec + len);
+    len += putVarint((uint32_t)(r.max - r.value[SERIES_MEAN]), rec + len);
+    uint8_t mask = 0;
+    for (uint8_t s = SERIES_SETPOINT; s < NUM_SERIES; ++s) {
+        if (delta[s] != 0) mask |= 1 << (s - 1);
+    }
+    rec[len++] = mask;
+    for (uint8_t s = SERIES_SETPOINT; s < NUM_SERIES; ++s) {
+        if (mask & (1 << (s - 1))) len += putVarint(zigzag(delta[s]), rec + len);
+    }
+
+    while (tier.count > 0 && TIER_BYTES - tier.used < len) evict(tier);
+    if (tier.count == 0) {
+        tier.head = 0;
+        tier.used = 0;
+        tier.firstIdx = idx;
+        for (uint8_t s = 0; s < NUM_SERIES; ++s) tier.headValue[s] = r.value[s];
+    }
+    uint16_t pos = (tier.head + tier.used) % TIER_BYTES;
+    for (uint8_t i = 0; i < len; ++i) {
+        tier.buf[pos] = rec[i];
+        pos = (pos + 1) % TIER_BYTES;
+    }
+    tier.used += len;
+    tier.count++;
+    for (uint8_t s = 0; s < NUM_SERIES; ++s) tier.tailValue[s] = r.value[s];
+}
+
+uint8_t HistoryStore::readRecord(const Tier& tier, uint16_t pos, const int16_t* prev, Record& r) const {
+    uint8_t len = 0;
+    auto next = [&]() -> uint32_t {
+        uint32_t result = 0;
+        uint8_t shift = 0;
+        uint8_t b;
+        do {
+            b = tier.buf[(pos + len++) % TIER_BYTES];
+            result |= (uint32_t)(b & 0x7F) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        return result;
+    };
+    r.value[SERIES_MEAN] = prev[SERIES_MEAN] + unzigzag(next());
+    r.min = r.value[SERIES_MEAN] - (int16_t)next();
+    r.max = r.value[SERIES_MEAN] + (int16_t)next();
+    uint8_t mask = tier.buf[(pos + len++) % TIER_BYTES];
+    for (uint8_t s = SERIES_SETPOINT; s < NUM_SERIES; ++s) {
+        r.value[s] = prev[s] + ((mask & (1 << (s - 1))) ? unzigzag(next()) : 0);
+    }
+    return len;
+}
+
+void HistoryStore::evict(Tier& tier) {
+    // The oldest record's deltas are meaningless (its values are headValue),
+    // so decode it against itself just to find its length
+    Record r;
+    uint8_t len = readRecord(tier, tier.head, tier.headValue, r);
+    tier.head = (tier.head + len) % TIER_BYTES;
+    tier.used -= len;
+    tier.count--;
+    tier.firstIdx++;
+    if (tier.count > 0) {
+        // The new oldest record's deltas were relative to the one just dropped
+        readRecord(tier, tier.head, tier.headValue, r);
+        for (uint8_t s = 0; s < NUM_SERIES; ++s) tier.headValue[s] = r.value[s];
+    }
+}
+
+void HistoryStore::toBucket(const Record& r, uint32_t idx, uint32_t bucketMs, Bucket& b) {
+    b.startMs = idx * bucketMs;
+    b.durationMs = bucketMs;
+    b.min = r.min;
+    b.mean = r.value[SERIES_MEAN];
+    b.max = r.max;
+    b.setpoint = r.value[SERIES_SETPOINT];
+    b.output = (uint8_t)r.value[SERIES_OUTPUT];
+    b.mainDuty = (uint8_t)r.value[SERIES_MAIN];
+    b.fryDuty = (uint8_t)r.value[SERIES_FRY];
+    for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) b.probes[i] = r.value[SERIES_PROBE + i];
+}
+
+void HistoryStore::visit(Visitor visitor, void* context) const {
+    // Each tier only covers time before the next finer tier starts
+    uint32_t endMs = 0xFFFFFFFF;
+    uint32_t tierEnd[NUM_TIERS];
+    for (uint8_t t = 0; t < NUM_TIERS; ++t) {
+        tierEnd[t] = endMs;
+        if (tiers[t].count > 0) endMs = tiers[t].firstIdx * tiers[t].bucketMs;
+    }
+
+    for (int8_t t = NUM_TIERS - 1; t >= 0; --t) {
+        const Tier& tier = tiers[t];
+        if (tier.count == 0) continue;
+        uint16_t pos = tier.head;
+        Record r;
+        int16_t prev[NUM_SERIES];
+        for (uint8_t s = 0; s < NUM_SERIES; ++s) prev[s] = tier.headValue[s];
+        for (uint16_t i = 0; i < tier.count; ++i) {
+            pos = (pos + readRecord(tier, pos, prev, r)) % TIER_BYTES;
+            if (i == 0) {
+                // Oldest record's stored deltas are stale; use the kept values
+                int16_t spreadLo = r.value[SERIES_MEAN] - r.min, spreadHi = r.max - r.value[SERIES_MEAN];
+                for (uint8_t s = 0; s < NUM_SERIES; ++s) r.value[s] = tier.headValue[s];
+                r.min = r.value[SERIES_MEAN] - spreadLo;
+                r.max = r.value[SERIES_MEAN] + spreadHi;
+            }
+            for (uint8_t s = 0; s < NUM_SERIES; ++s) prev[s] = r.value[s];
+
+            Bucket b;
+            toBucket(r, tier.firstIdx + i, tier.bucketMs, b);
+            if (b.startMs + b.durationMs > tierEnd[t]) break;
+            visitor(b, context);
+        }
+    }
+
+    const Tier& live = tiers[0];
+    if (live.accOpen) {
+        Record r;
+        r.min = live.accMin;
+        r.max = live.accMax;
+        for (uint8_t s = 0; s < NUM_SERIES; ++s) r.value[s] = mean(live, s);
+        Bucket b;
+        toBucket(r, live.accIdx, live.bucketMs, b);
+        visitor(b, context);
+    }
+}
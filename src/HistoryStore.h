@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdint.h>
+#include "ControlSample.h"
+
+// Tiered run history with a fixed memory budget. Tier 0 holds 1 s buckets;
+// each closed bucket also feeds the next tier's coarser bucket, so every
+// tier covers the most recent span its bytes allow at its resolution.
+//
+// A bucket packs temperature (min/mean/max, tenths of C), mean setpoint
+// (tenths of C), mean output and element duties (%) and each individual
+// probe's mean (tenths of C). Each is stored as a varint delta from the
+// previous bucket, with a mask byte so unchanged series cost nothing, in a
+// per-tier byte ring that drops its oldest bucket when full. With a single
+// probe the probe series never change, so they cost nothing either.
+class HistoryStore {
+public:
+    struct Bucket {
+        uint32_t startMs;      // From reset()
+        uint32_t durationMs;
+        int16_t min, mean, max;   // Temperature, tenths of C
+        int16_t setpoint;         // Tenths of C
+        uint8_t output;           // %
+        uint8_t mainDuty;         // %
+        uint8_t fryDuty;          // %
+        // Tenths of C, ControlSample::NO_READING_TENTHS where the probe had
+        // no reading for the whole bucket
+        int16_t probes[ControlSample::MAX_PROBES];
+    };
+    typedef void (*Visitor)(const Bucket& bucket, void* context);
+
+    static const uint8_t NUM_TIERS = 4;
+    static const uint16_t TIER_BYTES = 1280;
+
+    HistoryStore();
+    void reset(uint32_t nowMs);
+    // Adds one sample; may be called at any rate. Uses temp, setpoint,
+    // output, mainPWM, fryPWM and probes.
+    void add(uint32_t nowMs, const ControlSample& sample);
+
+    // Visits stored buckets oldest first, using the finest tier available
+    // for each span, then the open 1 s bucket
+    void visit(Visitor visitor, void* context) const;
+    // Highest temperature or setpoint since reset, tenths of C
+    int16_t maxValue() const { return maxSeen; }
+    bool empty() const { return samples == 0; }
+
+private:
+    // Series held per bucket; SERIES_MEAN is the temperature mean. Every
+    // series after it has a bit in the record's mask byte, so there can be
+    // at most nine.
+    enum Series {
+        SERIES_MEAN, SERIES_SETPOINT, SERIES_OUTPUT, SERIES_MAIN, SERIES_FRY, SERIES_PROBE,
+        NUM_SERIES = SERIES_PROBE + ControlSample::MAX_PROBES
+    };
+
+    struct Tier {
+        uint32_t bucketMs;
+        uint8_t* buf;
+        uint16_t head;         // Byte offset of the oldest record
+        uint16_t used;         // Bytes in use
+        uint16_t count;        // Records stored
+        uint32_t firstIdx;     // Bucket index of the oldest record
+        int16_t headValue[NUM_SERIES];   // Absolute values of the oldest record
+        int16_t tailValue[NUM_SERIES];   // Absolute values of the newest record
+        // Bucket being accumulated
+        bool accOpen;
+        uint32_t accIdx;
+        int16_t accMin, accMax;
+        int32_t accSum[NUM_SERIES];
+        uint16_t accN[NUM_SERIES];   // Samples with a reading
+    };
+
+    struct Record {
+        int16_t min, max;
+        int16_t value[NUM_SERIES];
+    };
+
+    static const uint32_t TIER_BUCKET_MS[NUM_TIERS];
+
+    uint8_t storage[NUM_TIERS * TIER_BYTES];
+    Tier tiers[NUM_TIERS];
+    uint32_t startMs;
+    uint32_t samples;
+    int16_t maxSeen;
+
+    void accumulate(uint8_t t, uint32_t idx, const Record& r);
+    // Mean of series s in the tier's open bucket
+    static int16_t mean(const Tier& tier, uint8_t s);
+    void close(uint8_t t);
+    void append(uint8_t t, uint32_t idx, const Record& r);
+    void evict(Tier& tier);
+    // Decodes the record at pos, taking prev as the previous record's
+    // values; returns its length in bytes
+    uint8_t readRecord(const Tier& tier, uint16_t pos, const int16_t* prev, Record& r) const;
+    static void toBucket(const Record& r, uint32_t idx, uint32_t bucketMs, Bucket& b);
+};
+
+// Shared by the oven and reflow screens, which never run at once
+extern HistoryStore runHistory;
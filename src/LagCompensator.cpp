@@ -0,0 +1,27 @@
+#include "LagCompensator.h"
+
+LagCompensator::LagCompensator(const Config& config)
+    : _config(config), _lead(0), _tauEff(0)
+{}
+
+float LagCompensator::apply(float temp, float rate, float rateSigma) {
+    float tau = _config.tau;
+    if (tau <= 0) {
+        _lead = 0;
+        _tauEff = 0;
+        return temp;
+    }
+
+    // Noise added by the lead is tau * rateSigma. Scale tau down smoothly as
+    // that approaches the budget rather than switching it off.
+    if (_config.noiseBudget > 0) {
+        float ratio = tau * rateSigma / _config.noiseBudget;
+        tau /= 1.0f + ratio * ratio;
+    }
+    _tauEff = tau;
+
+    _lead = tau * rate;
+    if (_lead > _config.maxLead) _lead = _config.maxLead;
+    else if (_lead < -_config.maxLead) _lead = -_config.maxLead;
+    return temp + _lead;
+}
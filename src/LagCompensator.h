@@ -0,0 +1,30 @@
+#pragma once
+
+// Lead compensation for a thermocouple that behaves as a first-order lag:
+// the surrounding temperature is roughly reading + tau * d(reading)/dt.
+// Differentiating amplifies noise, so the effective tau is shrunk when the
+// rate estimate is uncertain, keeping the added noise within noiseBudget,
+// and the correction is capped at maxLead.
+class LagCompensator {
+public:
+    struct Config {
+        float tau;            // Probe time constant (s), 0 = off
+        float noiseBudget;    // Allowed std dev added by the lead term (C)
+        float maxLead;        // Largest correction applied (C)
+    };
+
+    LagCompensator(const Config& config);
+    void setConfig(const Config& config) { _config = config; }
+    const Config& config() const { return _config; }
+    void setTau(float tau) { _config.tau = tau; }
+
+    // rate and rateSigma are the reading's rate of change and its std dev (C/s)
+    float apply(float temp, float rate, float rateSigma);
+    float lead() const { return _lead; }
+    float effectiveTau() const { return _tauEff; }
+
+private:
+    Config _config;
+    float _lead;
+    float _tauEff;
+};
@@ -1,14 +1,16 @@
 #include "MenuConfig.h"
 #include "Free_Fonts.h"
 #include "ArduinoMenu.h"
+#include <Temp.h>
 #include <Preferences.h>
+#include "SettingsStore.h"
 
 // === Reflow Profile Data ===
 ReflowProfile profiles[] = {
-  {150, 180, 220, 60}, // Lead-Free
-  {130, 160, 190, 50},  // Leaded
-  {130, 160, 190, 50},  // Low temp
-  {130, 160, 190, 50}   // Custom 2
+  {150, 180, 220, 60, 9, 120, 6}, // Lead-Free
+  {130, 160, 190, 50, 9, 120, 6},  // Leaded
+  {130, 160, 190, 50, 9, 120, 6},  // Low temp
+  {130, 160, 190, 50, 9, 120, 6}   // Custom 2
 };
 
 const char* profileNames[] = { "Lead-Free", "Leaded", "Low temp", "Custom 2" };
@@ -16,6 +18,12 @@ const char* profileNames[] = { "Lead-Free", "Leaded", "Low temp", "Custom 2" };
 // === Settings Variables ===
 int ovenTemp = 0;
 int Time = 15;
+OvenSettings settings = {
+  3,      // batch boards
+  100,    // standby C
+  0,      // probe lag
+  false   // text telemetry
+};
 
 // Define rotary input
 RotaryEventIn reIn(
@@ -28,34 +36,46 @@ RotaryEventIn reIn(
 MENU_INPUTS(in,&reIn);
 
 MENU(leadFreeMenu, "Lead-Free",doNothing,noEvent,noStyle
-  ,FIELD(profiles[0].preheatTemp, "Preheat", "C", 100, 200, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[0].soakTemp, "Soak", "C", 120, 220, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[0].peakTemp, "Peak", "C", 180, 250, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[0].dwellTime, "Dwell", "s", 20, 120, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
+  ,FIELD(profiles[0].preheatTemp, "Preheat", "C", 100, 200, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[0].soakTemp, "Soak", "C", 120, 220, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[0].peakTemp, "Peak", "C", 180, 250, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[0].dwellTime, "Dwell", "s", 20, 120, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[0].preheatRate, "Pre rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[0].soakTime, "Soak time", "s", 30, 240, 5, 1, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[0].peakRate, "Peak rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
   ,EXIT("< Back")
 );
 
 MENU(leadedMenu, "Leaded",doNothing,noEvent,noStyle
-  ,FIELD(profiles[1].preheatTemp, "Preheat", "C", 100, 180, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[1].soakTemp, "Soak", "C", 120, 200, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[1].peakTemp, "Peak", "C", 160, 230, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[1].dwellTime, "Dwell", "s", 20, 120, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
+  ,FIELD(profiles[1].preheatTemp, "Preheat", "C", 100, 180, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[1].soakTemp, "Soak", "C", 120, 200, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[1].peakTemp, "Peak", "C", 160, 230, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[1].dwellTime, "Dwell", "s", 20, 120, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[1].preheatRate, "Pre rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[1].soakTime, "Soak time", "s", 30, 240, 5, 1, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[1].peakRate, "Peak rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
   ,EXIT("< Back")
 );
 
 MENU(custom1Menu, "183 Low Temp",doNothing,noEvent,noStyle
-  ,FIELD(profiles[2].preheatTemp, "Preheat", "C", 100, 180, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[2].soakTemp, "Soak", "C", 120, 200, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[2].peakTemp, "Peak", "C", 160, 230, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[2].dwellTime, "Dwell", "s", 20, 120, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
+  ,FIELD(profiles[2].preheatTemp, "Preheat", "C", 100, 180, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[2].soakTemp, "Soak", "C", 120, 200, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[2].peakTemp, "Peak", "C", 160, 230, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[2].dwellTime, "Dwell", "s", 20, 120, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[2].preheatRate, "Pre rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[2].soakTime, "Soak time", "s", 30, 240, 5, 1, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[2].peakRate, "Peak rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
   ,EXIT("< Back")
 );
 
 MENU(custom2Menu, "Custom 2",doNothing,noEvent,noStyle
-  ,FIELD(profiles[3].preheatTemp, "Preheat", "C", 100, 180, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[3].soakTemp, "Soak", "C", 120, 200, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[3].peakTemp, "Peak", "C", 160, 230, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
-  ,FIELD(profiles[3].dwellTime, "Dwell", "s", 20, 120, 1, 0, saveProfilesToFlash,exitEvent,noStyle)
+  ,FIELD(profiles[3].preheatTemp, "Preheat", "C", 100, 180, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[3].soakTemp, "Soak", "C", 120, 200, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[3].peakTemp, "Peak", "C", 160, 230, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[3].dwellTime, "Dwell", "s", 20, 120, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[3].preheatRate, "Pre rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[3].soakTime, "Soak time", "s", 30, 240, 5, 1, profilesChanged,exitEvent,noStyle)
+  ,FIELD(profiles[3].peakRate, "Peak rate", "dC/s", 3, 30, 1, 0, profilesChanged,exitEvent,noStyle)
   ,EXIT("< Back")
 );
 
@@ -75,10 +95,34 @@ MENU(reflowStartMenu, "Start Reflow",doNothing,noEvent,noStyle
   ,EXIT("< Back")
 );
 
+MENU(batchMenu, "Batch Reflow",doNothing,noEvent,noStyle
+  ,FIELD(settings.batchRuns, "Boards", "", 1, 50, 1, 0, settingsChanged,exitEvent,noStyle)
+  ,FIELD(settings.standbyTemp, "Standby", "C", 0, 150, 5, 1, settingsChanged,exitEvent,noStyle)
+  ,OP("Batch Lead-Free",onBatchLeadFree,enterEvent)
+  ,OP("Batch Leaded",onBatchLeaded,enterEvent)
+  ,OP("Batch Low temp",onBatchLowTemp,enterEvent)
+  ,OP("Batch Custom 2",onBatchCustom2,enterEvent)
+  ,EXIT("< Back")
+);
+
+TOGGLE(settings.telemetryBinary,telemetryToggle,"Telemetry: ",settingsChanged,anyEvent,noStyle
+  ,VALUE("Text",false,doNothing,noEvent)
+  ,VALUE("Binary",true,doNothing,noEvent)
+);
+
+MENU(sensorMenu, "Sensor",doNothing,noEvent,noStyle
+  ,FIELD(settings.probeLag, "Probe lag", "ds", 0, 150, 5, 1, sensorSettingsChanged,exitEvent,noStyle)
+  ,SUBMENU(telemetryToggle)
+  ,EXIT("< Back")
+);
+
 MENU(mainMenu, "Workshop Oven",doNothing,noEvent,noStyle
   ,SUBMENU(reflowStartMenu)
+  ,SUBMENU(batchMenu)
   ,OP("Start Oven",onStartOven,enterEvent)
   ,SUBMENU(profileMenu)
+  ,SUBMENU(sensorMenu)
+  ,OP("Dump last run",onDumpRun,enterEvent)
 );
 
 idx_t serialTops[MAX_DEPTH]={0};
@@ -135,52 +179,130 @@ result onStartCustom2(eventMask e, navNode& nav, prompt &item) {
   gfx.setTextSize(2);
   return quit;
 }
+result onBatchLeadFree(eventMask e, navNode& nav, prompt &item) {
+  StartReflowBatch(profiles[0]);
+  gfx.fillScreen(Black);
+  gfx.setTextSize(2);
+  return quit;
+}
+result onBatchLeaded(eventMask e, navNode& nav, prompt &item) {
+  StartReflowBatch(profiles[1]);
+  gfx.fillScreen(Black);
+  gfx.setTextSize(2);
+  return quit;
+}
+result onBatchLowTemp(eventMask e, navNode& nav, prompt &item) {
+  StartReflowBatch(profiles[2]);
+  gfx.fillScreen(Black);
+  gfx.setTextSize(2);
+  return quit;
+}
+result onBatchCustom2(eventMask e, navNode& nav, prompt &item) {
+  StartReflowBatch(profiles[3]);
+  gfx.fillScreen(Black);
+  gfx.setTextSize(2);
+  return quit;
+}
 result onStartOven(eventMask e, navNode& nav, prompt &item) {
   StartOven();
   gfx.fillScreen(Black);
   gfx.setTextSize(2);
   return quit;
 }
+result onDumpRun(eventMask e, navNode& nav, prompt &item) {
+  DumpLastRun();
+  gfx.fillScreen(Black);
+  gfx.setTextSize(2);
+  return quit;
+}
+
+// Profiles and settings, each one CRC-checked blob in the "reflow" namespace.
+// Edits are written 3 s after the last one.
+#define PROFILES_VERSION 1
+#define SETTINGS_VERSION 1
+#define NUM_PROFILES 4
+
+SettingsStore settingsStore("reflow", 3000);
+static int8_t profilesRecord = -1;
+static int8_t settingsRecord = -1;
+
+// Per-value keys used before profiles were stored as a blob, p<n>_<key>
+static const struct {
+  const char* key;
+  int ReflowProfile::* field;
+} legacyProfileKeys[] = {
+  {"preheat", &ReflowProfile::preheatTemp},
+  {"soak",    &ReflowProfile::soakTemp},
+  {"peak",    &ReflowProfile::peakTemp},
+  {"dwell",   &ReflowProfile::dwellTime},
+  {"prate",   &ReflowProfile::preheatRate},
+  {"soakt",   &ReflowProfile::soakTime},
+  {"krate",   &ReflowProfile::peakRate},
+};
+#define NUM_LEGACY_KEYS (sizeof(legacyProfileKeys) / sizeof(legacyProfileKeys[0]))
+
+static void legacyProfileKey(char* key, size_t size, int profile, int field) {
+  snprintf(key, size, "p%d_%s", profile, legacyProfileKeys[field].key);
+}
 
-Preferences preferences;
-
-// Helper: Save all profiles to flash
-void saveProfilesToFlash() {
-  Serial.println("Saving profiles to flash...");
-  preferences.begin("reflow", false);
-  for (int i = 0; i < 4; ++i) {
-    char key[16];
-    snprintf(key, sizeof(key), "p%d_preheat", i);
-    preferences.putInt(key, profiles[i].preheatTemp);
-    snprintf(key, sizeof(key), "p%d_soak", i);
-    preferences.putInt(key, profiles[i].soakTemp);
-    snprintf(key, sizeof(key), "p%d_peak", i);
-    preferences.putInt(key, profiles[i].peakTemp);
-    snprintf(key, sizeof(key), "p%d_dwell", i);
-    preferences.putInt(key, profiles[i].dwellTime);
+// Version 0: the profiles as separate int keys
+static bool migrateProfiles(uint8_t fromVersion, const uint8_t* old, uint16_t oldSize,
+                            void* data, Preferences& prefs) {
+  if (fromVersion != 0 || !prefs.isKey("p0_preheat")) return false;
+  ReflowProfile* stored = (ReflowProfile*)data;
+  for (int i = 0; i < NUM_PROFILES; ++i) {
+    for (int f = 0; f < (int)NUM_LEGACY_KEYS; ++f) {
+      char key[16];
+      legacyProfileKey(key, sizeof(key), i, f);
+      int& value = stored[i].*legacyProfileKeys[f].field;
+      value = prefs.getInt(key, value);
+    }
   }
-  preferences.end();
-}
-
-// Helper: Load all profiles from flash (if present)
-void loadProfilesFromFlash() {
-  Serial.println("Loading profiles to flash...");
-  preferences.begin("reflow", true);
-  for (int i = 0; i < 4; ++i) {
-    char key[16];
-    snprintf(key, sizeof(key), "p%d_preheat", i);
-    int preheat = preferences.getInt(key, profiles[i].preheatTemp);
-    snprintf(key, sizeof(key), "p%d_soak", i);
-    int soak = preferences.getInt(key, profiles[i].soakTemp);
-    snprintf(key, sizeof(key), "p%d_peak", i);
-    int peak = preferences.getInt(key, profiles[i].peakTemp);
-    snprintf(key, sizeof(key), "p%d_dwell", i);
-    int dwell = preferences.getInt(key, profiles[i].dwellTime);
-    profiles[i].preheatTemp = preheat;
-    profiles[i].soakTemp = soak;
-    profiles[i].peakTemp = peak;
-    profiles[i].dwellTime = dwell;
+  return true;
+}
+
+// Drops the old keys once the blob holding their values is in flash
+static void removeLegacyProfileKeys() {
+  Preferences prefs;
+  prefs.begin("reflow", false);
+  if (prefs.isKey("p0_preheat")) {
+    for (int i = 0; i < NUM_PROFILES; ++i) {
+      for (int f = 0; f < (int)NUM_LEGACY_KEYS; ++f) {
+        char key[16];
+        legacyProfileKey(key, sizeof(key), i, f);
+        prefs.remove(key);
+      }
+    }
   }
-  preferences.end();
+  prefs.end();
+}
+
+void applySensorSettings() {
+  SetProbeLag(settings.probeLag / 10.0f);
+}
+
+void sensorSettingsChanged() {
+  applySensorSettings();
+  settingsChanged();
+}
+
+void profilesChanged() {
+  settingsStore.markDirty(profilesRecord);
+}
+
+void settingsChanged() {
+  settingsStore.markDirty(settingsRecord);
 }
 
+void loadSettingsFromFlash() {
+  Serial.println("Loading settings from flash...");
+  profilesRecord = settingsStore.add("profiles", profiles, sizeof(ReflowProfile) * NUM_PROFILES,
+                                     PROFILES_VERSION, migrateProfiles);
+  settingsRecord = settingsStore.add("settings", &settings, sizeof(settings), SETTINGS_VERSION);
+  settingsStore.load();
+  if (settingsStore.stored(profilesRecord)) removeLegacyProfileKeys();
+}
+
+void saveSettingsWhenIdle() {
+  settingsStore.service(millis());
+}
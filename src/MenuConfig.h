@@ -17,19 +17,36 @@
 #define fontH 20
 
 // === Reflow Profile Data ===
+// The menu-editable profiles are a fixed preheat/soak/peak/dwell/cool shape
+// that StartReflowProfile() maps onto five ProfileSegments. Vendor curves
+// with a different number of steps can only be written as ProfileSegment
+// lists in code for now; there is no menu entry or storage for them.
 struct ReflowProfile {
   int preheatTemp;
   int soakTemp;
   int peakTemp;
   int dwellTime;
+  int preheatRate;  // Tenths of C/s
+  int soakTime;     // s
+  int peakRate;     // Tenths of C/s
 };
 
 extern ReflowProfile profiles[];
 extern const char* profileNames[];
 
 // === Settings Variables ===
+// Stored in flash as one record, next to the profiles; bump SETTINGS_VERSION
+// (and add a migration) when the layout changes
+struct OvenSettings {
+  int batchRuns;
+  int standbyTemp;      // 0 = let the oven cool between boards
+  int probeLag;         // Probe time constant, tenths of s, 0 = no lag compensation
+  bool telemetryBinary; // Reflow telemetry as framed binary instead of text
+};
+
 extern int ovenTemp;
 extern int Time;
+extern OvenSettings settings;
 
 // === Menu Setup ===
 using namespace Menu;
@@ -49,8 +66,19 @@ result onStartLeaded(eventMask e, navNode& nav, prompt &item);
 result onStartLowTemp(eventMask e, navNode& nav, prompt &item);
 result onStartCustom2(eventMask e, navNode& nav, prompt &item);
 result onStartOven(eventMask e, navNode& nav, prompt &item);
-void saveProfilesToFlash();
-void loadProfilesFromFlash();
+result onDumpRun(eventMask e, navNode& nav, prompt &item);
+result onBatchLeadFree(eventMask e, navNode& nav, prompt &item);
+result onBatchLeaded(eventMask e, navNode& nav, prompt &item);
+result onBatchLowTemp(eventMask e, navNode& nav, prompt &item);
+result onBatchCustom2(eventMask e, navNode& nav, prompt &item);
+void applySensorSettings();
+// Menu edit handlers: mark the record for the next idle write
+void profilesChanged();
+void settingsChanged();
+void sensorSettingsChanged();
+void loadSettingsFromFlash();
+// Writes edited settings once the menu has been idle a few seconds
+void saveSettingsWhenIdle();
 
 // Optionally remove or comment out this if not used anymore
 // result onProfileStart(eventMask e, navNode& nav, prompt &item);
@@ -2,38 +2,26 @@
 
 #include <TFT_eSPI.h>
 #include <stdint.h>
+#include "Chart.h"
+#include "RunTraces.h"
+#include "ControlSample.h"
 
 class Oven {
 public:
-    struct DataPoint {
-        uint16_t temp;
-    };
-    static const int MAX_POINTS = 12 * 60 * 3; // 12 hours max at one per 20 seconds
-    static const unsigned long INC_MS = 20000UL; // 12 hours max at one per 10 seconds
-    
-
     Oven();
     void initGraph(TFT_eSPI& tft, int x, int y, int w, int h, float maxTemp=50.0, uint32_t totalTimeMins = 15);
-    void updateGraph(float actualTemp, float setTemp);
+    // Records the sample and draws its latest points
+    void updateGraph(const ControlSample& sample);
     void reset();
     void setGraphLimits(float maxTemp, uint32_t maxTimeMins);
     void redrawGraph();
 
 private:
-    float defaultTemp;
-    uint32_t maxTimeMs;
-    float graphMaxTemp;
-    uint32_t graphTotalTimeMins;
     uint32_t startTimeMs;
-    TFT_eSPI* tftRef;
-    int graphX, graphY, graphW, graphH;
     bool graphInitialized;
-    // Data points for graph
-    DataPoint points[MAX_POINTS];
-    int numPoints=0;
-    int32_t lastPointInc;
-    void recordPoint(uint32_t nowMs, float temp);
-    int tempToY(float temp) const;
-    int timeMsToX(uint32_t elapsedMs) const;
-    float currentSetpoint = 0.0f;
+    int32_t currentSetpoint = 0;   // Tenths of C
+    Chart chart;
+    RunTraces traces;
+    // Chart layer: the setpoint as a flat line until there's history to show
+    static void drawSetpoint(Chart& chart, void* context);
 };
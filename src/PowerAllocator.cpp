@@ -0,0 +1,74 @@
+#include "PowerAllocator.h"
+
+PowerAllocator::PowerAllocator(const Config& config)
+    : _config(config), _mainOnTime(0), _fryOnTime(0)
+{}
+
+void PowerAllocator::setConfig(const Config& config)
+{
+    _config = config;
+}
+
+void PowerAllocator::resetWear()
+{
+    _mainOnTime = 0;
+    _fryOnTime = 0;
+}
+
+PowerAllocator::Allocation PowerAllocator::allocate(float demandPct)
+{
+    float mainW = _config.mainWatts;
+    float fryW = _config.fryerWatts;
+    float capW = _config.mainsVolts * _config.currentCapA;
+    bool mainOk = mainW > 0 && mainW <= capW;
+    bool fryOk = fryW > 0 && fryW <= capW;
+    if (!mainOk) mainW = 0;
+    if (!fryOk) fryW = 0;
+    bool overlapOk = (mainW + fryW) <= capW;
+
+    float demandW = constrain(demandPct, 0.0f, 100.0f) / 100.0f * (_config.mainWatts + _config.fryerWatts);
+    if (demandW > mainW + fryW) demandW = mainW + fryW;
+
+    // Share of on-time given to main: even, nudged towards the less used element
+    float bias = 0.5f;
+    float used = _mainOnTime + _fryOnTime;
+    if (used > 0) {
+        bias += 0.5f * (_fryOnTime - _mainOnTime) / used;
+        bias = constrain(bias, 0.25f, 0.75f);
+    }
+    if (!mainOk) bias = 0;
+    if (!fryOk) bias = 1;
+
+    float mainDuty = 0, fryDuty = 0;
+    float wattsPerOnTime = bias * mainW + (1 - bias) * fryW;
+    float onTime = (wattsPerOnTime > 0) ? demandW / wattsPerOnTime : 0;
+
+    if (onTime <= 1) {
+        // Fits in one window without overlapping
+        mainDuty = bias * onTime;
+        fryDuty = (1 - bias) * onTime;
+    } else if (mainW != fryW && demandW <= (mainW > fryW ? mainW : fryW)) {
+        // Still fits back-to-back if the stronger element takes more of the window
+        mainDuty = constrain((demandW - fryW) / (mainW - fryW), 0.0f, 1.0f);
+        fryDuty = 1 - mainDuty;
+    } else if (overlapOk) {
+        // Needs both on together for part of the window; run them at equal duty
+        mainDuty = fryDuty = demandW / (mainW + fryW);
+    } else {
+        // Capped: the best we can do is the stronger element on its own
+        if (mainW >= fryW) mainDuty = 1;
+        else fryDuty = 1;
+    }
+
+    Allocation a;
+    a.mainPWM = (uint8_t)(mainDuty * 100 + 0.5f);
+    a.fryPWM = (uint8_t)(fryDuty * 100 + 0.5f);
+    if (!overlapOk && a.mainPWM + a.fryPWM > 100) a.fryPWM = 100 - a.mainPWM;
+    // Fryer starts where main stops, so the SSRs never switch on together
+    a.fryOffset = a.mainPWM % 100;
+    a.watts = a.mainPWM / 100.0f * mainW + a.fryPWM / 100.0f * fryW;
+
+    _mainOnTime += a.mainPWM / 100.0f;
+    _fryOnTime += a.fryPWM / 100.0f;
+    return a;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Splits the controller's total power demand between the main and fryer
+// elements. Keeps the two SSRs from switching on together, only lets their
+// on-periods overlap when the demand can't be met otherwise and the combined
+// current is within the mains cap, and shifts on-time towards whichever
+// element has been used less.
+class PowerAllocator {
+public:
+    struct Config {
+        float mainWatts;
+        float fryerWatts;
+        float mainsVolts;
+        float currentCapA;     // Most the elements may draw together
+    };
+
+    struct Allocation {
+        uint8_t mainPWM;       // 0-100 % of the PWM window
+        uint8_t fryPWM;
+        uint8_t fryOffset;     // Fryer on-period start, % into the window
+        float watts;           // Average power actually allocated
+    };
+
+    PowerAllocator(const Config& config);
+    void setConfig(const Config& config);
+
+    // demandPct is 0-100 % of the combined element power
+    Allocation allocate(float demandPct);
+    void resetWear();
+
+private:
+    Config _config;
+    float _mainOnTime;         // Accumulated duty, for wear balancing
+    float _fryOnTime;
+};
@@ -0,0 +1,166 @@
+#include "ReflowTrajectory.h"
+#include <math.h>
+
+ReflowTrajectory::ReflowTrajectory()
+    : segments(nullptr), capacity(0), count(0), cursor(0)
+{}
+
+ReflowTrajectory::~ReflowTrajectory() {
+    delete[] segments;
+}
+
+void ReflowTrajectory::reserve(uint8_t segmentCount) {
+    if (segmentCount <= capacity) return;
+    Segment* grown = new Segment[segmentCount];
+    for (uint8_t i = 0; i < count; ++i) grown[i] = segments[i];
+    delete[] segments;
+    segments = grown;
+    capacity = segmentCount;
+}
+
+void ReflowTrajectory::clear() {
+    count = 0;
+    cursor = 0;
+}
+
+bool ReflowTrajectory::addSegment(uint8_t phase, uint32_t durationMs, float startTemp, float endTemp) {
+    if (count >= capacity) return false;
+    Segment& s = segments[count];
+    s.startMs = (count > 0) ? segments[count - 1].endMs : 0;
+    s.endMs = s.startMs + durationMs;
+    s.startTemp = startTemp;
+    s.slope = (durationMs > 0) ? (endTemp - startTemp) / ((float)durationMs / 1000.0f) : 0.0f;
+    s.curvature = 0.0f;
+    s.cubic = 0.0f;
+    s.phase = phase;
+    count++;
+    return true;
+}
+
+void ReflowTrajectory::smoothCorners(float maxAccel, float maxFraction) {
+    if (maxAccel <= 0 || count < 2 || count > 255 / 3) return;
+
+    // Slope at each knot and the blend length (ms) at each end of every segment
+    struct Blend { float kneeIn, kneeOut; uint32_t blendIn, blendOut; };
+    Blend* blends = new Blend[count];
+    for (uint8_t i = 0; i < count; ++i) {
+        blends[i].blendIn = blends[i].blendOut = 0;
+        blends[i].kneeIn = blends[i].kneeOut = segments[i].slope;
+    }
+    for (uint8_t k = 1; k < count; ++k) {
+        const Segment& a = segments[k - 1];
+        const Segment& b = segments[k];
+        // Only blend where the trajectory is continuous
+        if (fabsf(valueIn(a, a.endMs) - b.startTemp) > 0.5f) continue;
+
+        float sA = a.slope, sB = b.slope;
+        float knee = (sA * sB > 0) ? (sA + sB) / 2.0f : 0.0f;
+        float hA = 4.0f * fabsf(knee - sA) / maxAccel * 1000.0f;
+        float hB = 4.0f * fabsf(knee - sB) / maxAccel * 1000.0f;
+        float limitA = maxFraction * (a.endMs - a.startMs);
+        float limitB = maxFraction * (b.endMs - b.startMs);
+        blends[k - 1].blendOut = (uint32_t)(hA < limitA ? hA : limitA);
+        blends[k].blendIn = (uint32_t)(hB < limitB ? hB : limitB);
+        blends[k - 1].kneeOut = knee;
+        blends[k].kneeIn = knee;
+    }
+
+    Segment* out = new Segment[count * 3];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < count; ++i) {
+        const Segment& seg = segments[i];
+        float s = seg.slope;
+        float durS = (seg.endMs - seg.startMs) / 1000.0f;
+
+        // Cubic from the knot slope back onto the line:
+        // e(t) = D*(t^3/h^2 - 2t^2/h + t), D = knee - slope
+        if (blends[i].blendIn > 0) {
+            float h = blends[i].blendIn / 1000.0f;
+            float d = blends[i].kneeIn - s;
+            Segment& p = out[n++];
+            p = seg;
+            p.endMs = seg.startMs + blends[i].blendIn;
+            p.slope = s + d;
+            p.curvature = -2.0f * d / h;
+            p.cubic = d / (h * h);
+        }
+
+        uint32_t midStart = seg.startMs + blends[i].blendIn;
+        uint32_t midEnd = seg.endMs - blends[i].blendOut;
+        if (midEnd > midStart || (blends[i].blendIn == 0 && blends[i].blendOut == 0)) {
+            Segment& p = out[n++];
+            p = seg;
+            p.startMs = midStart;
+            p.endMs = midEnd;
+            p.startTemp = seg.startTemp + s * (blends[i].blendIn / 1000.0f);
+        }
+
+        // Cubic leaving the line to arrive at the knot with the knot slope:
+        // e(t) = D*(t^3/h^2 - t^2/h)
+        if (blends[i].blendOut > 0) {
+            float h = blends[i].blendOut / 1000.0f;
+            float d = blends[i].kneeOut - s;
+            Segment& p = out[n++];
+            p = seg;
+            p.startMs = midEnd;
+            p.startTemp = seg.startTemp + s * (durS - h);
+            p.curvature = -d / h;
+            p.cubic = d / (h * h);
+        }
+    }
+
+    delete[] blends;
+    delete[] segments;
+    segments = out;
+    capacity = count * 3;
+    count = n;
+    cursor = 0;
+}
+
+uint8_t ReflowTrajectory::find(uint32_t elapsedMs) const {
+    uint8_t i = cursor < count ? cursor : 0;
+    while (i > 0 && elapsedMs < segments[i].startMs) i--;
+    while (i + 1 < count && elapsedMs >= segments[i].endMs) i++;
+    cursor = i;
+    return i;
+}
+
+float ReflowTrajectory::valueIn(const Segment& s, uint32_t elapsedMs) {
+    if (elapsedMs > s.endMs) elapsedMs = s.endMs;
+    float t = (elapsedMs > s.startMs) ? (float)(elapsedMs - s.startMs) / 1000.0f : 0.0f;
+    return s.startTemp + t * (s.slope + t * (s.curvature + t * s.cubic));
+}
+
+float ReflowTrajectory::slopeIn(const Segment& s, uint32_t elapsedMs) {
+    if (elapsedMs > s.endMs) elapsedMs = s.endMs;
+    float t = (elapsedMs > s.startMs) ? (float)(elapsedMs - s.startMs) / 1000.0f : 0.0f;
+    return s.slope + t * (2.0f * s.curvature + 3.0f * t * s.cubic);
+}
+
+ReflowTrajectory::Sample ReflowTrajectory::sample(uint32_t elapsedMs, uint32_t lookaheadMs) const {
+    Sample out = {0, 0, 0, 0};
+    if (count == 0) return out;
+
+    const Segment& s = segments[find(elapsedMs)];
+    out.setpoint = valueIn(s, elapsedMs);
+    out.slope = slopeIn(s, elapsedMs);
+    out.phase = s.phase;
+
+    // Lookahead is always at or after elapsedMs, so scan forward from here
+    // without disturbing the cursor.
+    uint32_t aheadMs = elapsedMs + lookaheadMs;
+    uint8_t j = cursor;
+    while (j + 1 < count && aheadMs >= segments[j].endMs) j++;
+    out.lookaheadSlope = slopeIn(segments[j], aheadMs);
+    return out;
+}
+
+float ReflowTrajectory::valueAt(uint32_t elapsedMs) const {
+    if (count == 0) return 0;
+    return valueIn(segments[find(elapsedMs)], elapsedMs);
+}
+
+float ReflowTrajectory::slopeAt(uint32_t elapsedMs) const {
+    if (count == 0) return 0;
+    return slopeIn(segments[find(elapsedMs)], elapsedMs);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+
+// Piecewise setpoint trajectory compiled from the reflow phases when a reflow
+// starts. Each segment holds its cumulative start/end time and a polynomial
+// T(t) = startTemp + slope*t + curvature*t^2 + cubic*t^3 (t in seconds from
+// segment start), so the control loop can get setpoint and slope from one
+// timestamp without walking the phase list.
+class ReflowTrajectory {
+public:
+    struct Segment {
+        uint32_t startMs;   // Time from reflow start
+        uint32_t endMs;
+        float startTemp;
+        float slope;        // C/s at segment start
+        float curvature;    // C/s^2, 0 for a linear ramp
+        float cubic;        // C/s^3, used by corner blends
+        uint8_t phase;      // Phase this segment belongs to
+    };
+
+    struct Sample {
+        float setpoint;
+        float slope;            // C/s at the sample time
+        float lookaheadSlope;   // C/s at sample time + lookahead
+        uint8_t phase;
+    };
+
+    ReflowTrajectory();
+    ~ReflowTrajectory();
+
+    // Sizes the segment table; only reallocates when it needs to grow
+    void reserve(uint8_t segmentCount);
+    void clear();
+    bool addSegment(uint8_t phase, uint32_t durationMs, float startTemp, float endTemp);
+
+    // Rounds the corners between linear segments with cubic blends whose rate
+    // of change of slope is at most maxAccel C/s^2. Every knot keeps its time
+    // and temperature. Where the slope changes sign or one side is flat, the
+    // blend arrives at the knot level without crossing it. Blends may take at
+    // most maxFraction of a segment, so short segments can exceed maxAccel.
+    void smoothCorners(float maxAccel, float maxFraction = 0.45f);
+
+    // Setpoint and slope at elapsedMs, plus the slope lookaheadMs later.
+    // Times past the end clamp to the final segment.
+    Sample sample(uint32_t elapsedMs, uint32_t lookaheadMs) const;
+    float valueAt(uint32_t elapsedMs) const;
+    float slopeAt(uint32_t elapsedMs) const;
+    // Value/slope of a given segment, clamped to its end (for drawing)
+    static float valueIn(const Segment& s, uint32_t elapsedMs);
+    static float slopeIn(const Segment& s, uint32_t elapsedMs);
+
+    uint8_t numSegments() const { return count; }
+    const Segment& segment(uint8_t i) const { return segments[i]; }
+    uint32_t totalTimeMs() const { return count > 0 ? segments[count - 1].endMs : 0; }
+
+private:
+    ReflowTrajectory(const ReflowTrajectory&) = delete;
+    ReflowTrajectory& operator=(const ReflowTrajectory&) = delete;
+
+    Segment* segments;
+    uint8_t capacity;
+    uint8_t count;
+    // Last segment found; time normally only moves forward so the next
+    // lookup is at the same or next index.
+    mutable uint8_t cursor;
+
+    uint8_t find(uint32_t elapsedMs) const;
+};
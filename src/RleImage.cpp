@@ -0,0 +1,51 @@
+#include "RleImage.h"
+#include <pgmspace.h>
+
+RleImage::RleImage(const uint8_t* data, uint32_t size)
+    : data(data), size(size), pos(0), remaining(0), repeat(false), color(0)
+{}
+
+bool RleImage::read(uint16_t* out, uint16_t count) {
+    while (count > 0) {
+        if (remaining == 0) {
+            if (pos >= size) return false;
+            uint8_t header = pgm_read_byte(data + pos++);
+            remaining = (header & 0x7F) + 1;
+            repeat = header & 0x80;
+            if (repeat) {
+                if (pos + 2 > size) return false;
+                color = pgm_read_byte(data + pos) | (pgm_read_byte(data + pos + 1) << 8);
+                pos += 2;
+            }
+        }
+        uint8_t n = remaining < count ? remaining : count;
+        if (repeat) {
+            for (uint8_t i = 0; i < n; ++i) *out++ = color;
+        } else {
+            if (pos + 2 * n > size) return false;
+            for (uint8_t i = 0; i < n; ++i, pos += 2) {
+                *out++ = pgm_read_byte(data + pos) | (pgm_read_byte(data + pos + 1) << 8);
+            }
+        }
+        remaining -= n;
+        count -= n;
+    }
+    return true;
+}
+
+bool RleImage::draw(TFT_eSPI& tft, int32_t x, int32_t y, uint16_t width, uint16_t height,
+                    const uint8_t* data, uint32_t size) {
+    if (width > MAX_WIDTH) return false;
+    RleImage image(data, size);
+    uint16_t line[MAX_WIDTH];
+    bool ok = true;
+
+    tft.startWrite();
+    tft.setAddrWindow(x, y, width, height);
+    for (uint16_t row = 0; row < height && ok; ++row) {
+        ok = image.read(line, width);
+        if (ok) tft.pushPixels(line, width);
+    }
+    tft.endWrite();
+    return ok;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <TFT_eSPI.h>
+#include <stdint.h>
+
+// Draws an image generated with encoding = rle by tools/assets.py. The
+// stream is decoded one line at a time into a small buffer and pushed
+// straight to the panel inside one SPI transaction, so the full bitmap never
+// exists in RAM or flash. Pixels go out exactly as pushImage() would send
+// them.
+class RleImage {
+public:
+    static const uint16_t MAX_WIDTH = 160;
+
+    // Returns false if the image is wider than MAX_WIDTH or the stream is
+    // shorter than width * height pixels
+    static bool draw(TFT_eSPI& tft, int32_t x, int32_t y, uint16_t width, uint16_t height,
+                     const uint8_t* data, uint32_t size);
+
+private:
+    RleImage(const uint8_t* data, uint32_t size);
+
+    // Fills count pixels, carrying partial packets over to the next call
+    bool read(uint16_t* out, uint16_t count);
+
+    const uint8_t* data;
+    uint32_t size;
+    uint32_t pos;
+    uint8_t remaining;   // Pixels left in the current packet
+    bool repeat;         // Current packet is a run rather than literals
+    uint16_t color;      // Run pixel
+};
@@ -0,0 +1,349 @@
+#include "RunRecorder.h"
+#include <LittleFS.h>
+
+#define RUN_DIR "/runs"
+
+// Fields in record order, with the scale each is stored at
+enum Field {
+    F_TIME,       // 10 ms
+    F_TEMP,       // 0.1 C
+    F_SETPOINT,   // 0.1 C
+    F_RATE,       // 0.01 C/s
+    F_P, F_I, F_D, F_FF, F_OUTPUT,   // 1 %
+    F_MAIN, F_FRY, F_FAN, F_PHASE,
+    F_PROBE0,     // 0.1 C per probe, NO_READING_TENTHS without a reading
+    F_FAULT = F_PROBE0 + ControlSample::MAX_PROBES   // 0/1 sensorFault
+};
+
+// Time and setpoint move in straight lines, so they are predicted from the
+// last two records; everything else from the last record
+static inline bool linearField(uint8_t f) {
+    return f == F_TIME || f == F_SETPOINT;
+}
+
+RunRecorder runRecorder;
+
+RunRecorder::RunRecorder()
+    : activePage(0), pageRecords(0), mounted(false), active(false),
+      nextRunId(0), dropped(0), bytes(0), queue(nullptr)
+{
+    pages[0].length = pages[1].length = 0;
+    pages[0].busy = pages[1].busy = false;
+}
+
+void RunRecorder::runPath(uint32_t runId, char* path, size_t size) {
+    snprintf(path, size, RUN_DIR "/r%u.bin", (unsigned)(runId % MAX_RUNS));
+}
+
+bool RunRecorder::begin() {
+    if (mounted) return true;
+    if (!LittleFS.begin(true)) {
+        Serial.println("LittleFS mount failed, run recording disabled");
+        return false;
+    }
+    if (!LittleFS.exists(RUN_DIR)) LittleFS.mkdir(RUN_DIR);
+
+    // Carry on numbering after the newest stored run
+    for (uint8_t i = 0; i < MAX_RUNS; ++i) {
+        char path[24];
+        runPath(i, path, sizeof(path));
+        File f = LittleFS.open(path, FILE_READ);
+        if (!f) continue;
+        RunInfo info;
+        if (f.read((uint8_t*)&info, sizeof(info)) == sizeof(info) && info.magic == MAGIC &&
+            info.runId >= nextRunId) {
+            nextRunId = info.runId + 1;
+        }
+        f.close();
+    }
+
+    queue = xQueueCreate(4, sizeof(Message));
+    xTaskCreatePinnedToCore(writerTask, "recorder", 4096, this, 1, nullptr, 0);
+    mounted = true;
+    return true;
+}
+
+bool RunRecorder::startRun(const RunInfo& info) {
+    if (!mounted) return false;
+    if (active) endRun();
+
+    Message msg;
+    msg.command = OPEN;
+    msg.page = 0;
+    msg.info = info;
+    msg.info.magic = MAGIC;
+    msg.info.version = VERSION;
+    msg.info.headerSize = sizeof(RunInfo);
+    msg.info.runId = nextRunId;
+    if (xQueueSend(queue, &msg, pdMS_TO_TICKS(100)) != pdTRUE) return false;
+
+    nextRunId++;
+    pages[activePage].length = 0;
+    pageRecords = 0;
+    dropped = 0;
+    bytes = sizeof(RunInfo);
+    active = true;
+    return true;
+}
+
+void RunRecorder::record(const ControlSample& sample) {
+    if (!active) return;
+
+    Page* page = &pages[activePage];
+    if (page->length + MAX_RECORD > PAGE_SIZE && !flushPage()) {
+        // Writer still busy with the other page
+        dropped++;
+        return;
+    }
+    page = &pages[activePage];
+
+    int32_t q[NUM_FIELDS];
+    quantise(sample, q);
+    uint8_t n = encode(q, prev, prev2, pageRecords, page->data + page->length);
+    page->length += n;
+    pageRecords++;
+    bytes += n;
+}
+
+bool RunRecorder::flushPage() {
+    Page& page = pages[activePage];
+    if (page.length == 0) return true;
+    uint8_t other = activePage ^ 1;
+    if (pages[other].busy) return false;
+
+    page.busy = true;
+    Message msg;
+    msg.command = WRITE;
+    msg.page = activePage;
+    if (xQueueSend(queue, &msg, 0) != pdTRUE) {
+        page.busy = false;
+        return false;
+    }
+    bytes += sizeof(uint16_t);
+    activePage = other;
+    pages[activePage].length = 0;
+    pageRecords = 0;
+    return true;
+}
+
+void RunRecorder::endRun() {
+    if (!active) return;
+    active = false;
+
+    // Not time-critical: give the writer up to a second to free a page
+    for (int tries = 0; tries < 100 && !flushPage(); ++tries) delay(10);
+
+    Message msg;
+    msg.command = CLOSE;
+    msg.page = 0;
+    xQueueSend(queue, &msg, pdMS_TO_TICKS(1000));
+    Serial.printf("Run %u recorded: %u bytes, %u records dropped\n",
+                  (unsigned)(nextRunId - 1), (unsigned)bytes, (unsigned)dropped);
+}
+
+void RunRecorder::writerTask(void* arg) {
+    RunRecorder* self = (RunRecorder*)arg;
+    File file;
+    Message msg;
+    for (;;) {
+        if (xQueueReceive(self->queue, &msg, portMAX_DELAY) != pdTRUE) continue;
+        switch (msg.command) {
+        case OPEN: {
+            if (file) file.close();
+            char path[24];
+            runPath(msg.info.runId, path, sizeof(path));
+            file = LittleFS.open(path, FILE_WRITE);
+            if (file) file.write((const uint8_t*)&msg.info, sizeof(RunInfo));
+            break;
+        }
+        case WRITE: {
+            Page& page = self->pages[msg.page];
+            if (file) {
+                file.write((const uint8_t*)&page.length, sizeof(page.length));
+                file.write(page.data, page.length);
+                file.flush();
+            }
+            page.busy = false;
+            break;
+        }
+        case CLOSE:
+            if (file) file.close();
+            break;
+        }
+    }
+}
+
+// --- Record codec ---
+
+static inline int32_t roundTo(float value, float scale) {
+    float v = value * scale;
+    return (int32_t)(v < 0 ? v - 0.5f : v + 0.5f);
+}
+
+void RunRecorder::quantise(const ControlSample& s, int32_t* q) {
+    q[F_TIME] = s.timeMs / 10;
+    q[F_TEMP] = fixedToTenths(s.temp);
+    q[F_SETPOINT] = roundTo(s.setpoint, 10);
+    q[F_RATE] = roundTo(s.rate, 100);
+    q[F_P] = roundTo(s.p, 1);
+    q[F_I] = roundTo(s.i, 1);
+    q[F_D] = roundTo(s.d, 1);
+    q[F_FF] = roundTo(s.feedForward, 1);
+    q[F_OUTPUT] = roundTo(s.output, 1);
+    q[F_MAIN] = s.mainPWM;
+    q[F_FRY] = s.fryPWM;
+    q[F_FAN] = s.fanDuty;
+    q[F_PHASE] = s.phase;
+    for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+        q[F_PROBE0 + i] = ControlSample::probeTenths(s.probes[i]);
+    }
+    q[F_FAULT] = s.sensorFault;
+}
+
+void RunRecorder::dequantise(const int32_t* q, ControlSample& s) {
+    s.timeMs = (uint32_t)q[F_TIME] * 10;
+    s.temp = fixedFromTenths(q[F_TEMP]);
+    s.setpoint = q[F_SETPOINT] / 10.0f;
+    s.rate = q[F_RATE] / 100.0f;
+    s.p = q[F_P];
+    s.i = q[F_I];
+    s.d = q[F_D];
+    s.feedForward = q[F_FF];
+    s.output = q[F_OUTPUT];
+    s.mainPWM = q[F_MAIN];
+    s.fryPWM = q[F_FRY];
+    s.fanDuty = q[F_FAN];
+    s.phase = q[F_PHASE];
+    for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+        int32_t tenths = q[F_PROBE0 + i];
+        s.probes[i] = tenths == ControlSample::NO_READING_TENTHS ? ControlSample::NO_READING
+                                                                 : fixedFromTenths(tenths);
+    }
+    s.sensorFault = q[F_FAULT] != 0;
+}
+
+static inline int32_t predict(uint8_t f, const int32_t* prev, const int32_t* prev2, uint16_t n) {
+    if (n == 0) return 0;
+    if (n >= 2 && linearField(f)) return 2 * prev[f] - prev2[f];
+    return prev[f];
+}
+
+static uint8_t putVarint(uint32_t v, uint8_t* out) {
+    uint8_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+static uint8_t getVarint(const uint8_t* in, uint16_t len, uint32_t* v) {
+    uint32_t result = 0;
+    for (uint8_t n = 0; n < 5 && n < len; ++n) {
+        result |= (uint32_t)(in[n] & 0x7F) << (7 * n);
+        if (!(in[n] & 0x80)) {
+            *v = result;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+// Record: varint bitmask of fields with a non-zero residual, then each of
+// those residuals as a zigzag varint
+uint8_t RunRecorder::encode(const int32_t* q, int32_t* prev, int32_t* prev2, uint16_t n, uint8_t* out) {
+    int32_t residual[NUM_FIELDS];
+    uint32_t mask = 0;
+    for (uint8_t f = 0; f < NUM_FIELDS; ++f) {
+        residual[f] = q[f] - predict(f, prev, prev2, n);
+        if (residual[f] != 0) mask |= 1u << f;
+    }
+    uint8_t len = putVarint(mask, out);
+    for (uint8_t f = 0; f < NUM_FIELDS; ++f) {
+        if (!(mask & (1u << f))) continue;
+        uint32_t zigzag = ((uint32_t)residual[f] << 1) ^ (uint32_t)(residual[f] >> 31);
+        len += putVarint(zigzag, out + len);
+    }
+    for (uint8_t f = 0; f < NUM_FIELDS; ++f) {
+        prev2[f] = prev[f];
+        prev[f] = q[f];
+    }
+    return len;
+}
+
+uint8_t RunRecorder::decode(const uint8_t* in, uint16_t len, int32_t* prev, int32_t* prev2, uint16_t n, int32_t* q) {
+    uint32_t mask;
+    uint8_t used = getVarint(in, len, &mask);
+    if (used == 0) return 0;
+    for (uint8_t f = 0; f < NUM_FIELDS; ++f) {
+        int32_t residual = 0;
+        if (mask & (1u << f)) {
+            uint32_t zigzag;
+            uint8_t k = getVarint(in + used, len - used, &zigzag);
+            if (k == 0) return 0;
+            used += k;
+            residual = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+        }
+        q[f] = predict(f, prev, prev2, n) + residual;
+    }
+    for (uint8_t f = 0; f < NUM_FIELDS; ++f) {
+        prev2[f] = prev[f];
+        prev[f] = q[f];
+    }
+    return used;
+}
+
+bool RunRecorder::dumpRun(uint8_t runsBack, Print& out) {
+    if (!mounted || nextRunId == 0 || runsBack >= MAX_RUNS || runsBack >= nextRunId) return false;
+    uint32_t runId = nextRunId - 1 - runsBack;
+    char path[24];
+    runPath(runId, path, sizeof(path));
+    File f = LittleFS.open(path, FILE_READ);
+    if (!f) return false;
+
+    RunInfo info;
+    if (f.read((uint8_t*)&info, sizeof(info)) != sizeof(info) || info.magic != MAGIC ||
+        info.runId != runId) {
+        f.close();
+        return false;
+    }
+    f.seek(info.headerSize);
+    out.printf("# run %u %s preheat %d@%d soak %d/%ds peak %d@%d dwell %ds Kp %.3f Ki %.3f Kd %.3f start %.1fC%s\n",
+               (unsigned)info.runId, info.profileName, info.preheatTemp, info.preheatRate,
+               info.soakTemp, info.soakTime, info.peakTemp, info.peakRate, info.dwellTime,
+               info.kp, info.ki, info.kd, info.startTemp, info.warmStart ? " warm" : "");
+    out.println("time_s,temp,setpoint,rate,p,i,d,ff,output,main,fry,fan,phase,probe1,probe2,probe3,probe4,fault");
+    // Version 1 runs predate the probe fields
+    bool hasProbes = info.version >= 2;
+
+    static uint8_t buffer[PAGE_SIZE];
+    uint16_t length;
+    while (f.read((uint8_t*)&length, sizeof(length)) == sizeof(length) && length <= PAGE_SIZE) {
+        if (f.read(buffer, length) != length) break;
+        int32_t p1[NUM_FIELDS], p2[NUM_FIELDS], q[NUM_FIELDS];
+        uint16_t pos = 0, n = 0;
+        while (pos < length) {
+            uint8_t used = decode(buffer + pos, length - pos, p1, p2, n, q);
+            if (used == 0) break;
+            pos += used;
+            n++;
+            ControlSample s;
+            dequantise(q, s);
+            out.printf("%.2f,%.1f,%.1f,%.2f,%.0f,%.0f,%.0f,%.0f,%.0f,%u,%u,%u,%u",
+                       s.timeMs / 1000.0f, fixedToC(s.temp), s.setpoint, s.rate, s.p, s.i, s.d,
+                       s.feedForward, s.output, s.mainPWM, s.fryPWM, s.fanDuty, s.phase);
+            for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+                if (hasProbes && s.probes[i] != ControlSample::NO_READING) {
+                    out.printf(",%.1f", fixedToC(s.probes[i]));
+                } else {
+                    out.print(',');
+                }
+            }
+            // Older runs decode the missing field as 0
+            out.printf(",%u\n", s.sensorFault ? 1 : 0);
+        }
+    }
+    f.close();
+    return true;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Arduino.h>
+#include "ControlSample.h"
+
+// Records every control tick of a reflow to LittleFS. Records are delta
+// encoded as varints into fixed-size pages; full pages are handed to a
+// writer task so the control loop never waits on flash. If the writer falls
+// behind, records are dropped (and counted) rather than blocking.
+//
+// Runs are kept in a ring of MAX_RUNS files, /runs/r<n>.bin with
+// n = runId % MAX_RUNS, so the oldest run is overwritten.
+//
+// File layout: RunInfo header, then pages of [uint16 length][records].
+// Each page restarts the predictor so pages decode independently.
+class RunRecorder {
+public:
+    static const uint8_t MAX_RUNS = 8;
+    static const uint16_t PAGE_SIZE = 512;
+    static const uint32_t MAGIC = 0x314C4652;   // "RFL1"
+    static const uint16_t VERSION = 3;     // 2 added the probe fields, 3 the fault flag
+
+    struct RunInfo {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint32_t runId;
+        char profileName[16];
+        int16_t preheatTemp, soakTemp, peakTemp, dwellTime;
+        int16_t preheatRate, soakTime, peakRate;   // Rates in tenths of C/s
+        uint8_t warmStart;
+        uint8_t reserved;
+        float kp, ki, kd;
+        float startTemp;
+    } __attribute__((packed));
+
+    RunRecorder();
+    // Mounts LittleFS and starts the writer task. Returns false if the
+    // filesystem couldn't be mounted; recording is then a no-op.
+    bool begin();
+
+    // Starts a new run file; magic, version, headerSize and runId are filled in
+    bool startRun(const RunInfo& info);
+    void record(const ControlSample& sample);
+    // Queues the last partial page and closes the file
+    void endRun();
+
+    bool recording() const { return active; }
+    uint32_t lastRunId() const { return nextRunId - 1; }
+    uint32_t droppedRecords() const { return dropped; }
+    uint32_t recordedBytes() const { return bytes; }
+
+    // Decodes a stored run (0 = latest) to CSV. Runs on the caller's task.
+    bool dumpRun(uint8_t runsBack, Print& out);
+
+    // Record codec, also used by dumpRun
+    static const uint8_t NUM_FIELDS = 14 + ControlSample::MAX_PROBES;
+    static const uint8_t MAX_RECORD = 3 + NUM_FIELDS * 5;
+    static void quantise(const ControlSample& sample, int32_t* q);
+    static void dequantise(const int32_t* q, ControlSample& sample);
+    // Encodes q against the predictor history; returns bytes written
+    // (n = records already in the page), updating the history
+    static uint8_t encode(const int32_t* q, int32_t* prev, int32_t* prev2, uint16_t n, uint8_t* out);
+    // Decodes one record; returns bytes consumed, 0 if truncated
+    static uint8_t decode(const uint8_t* in, uint16_t len, int32_t* prev, int32_t* prev2, uint16_t n, int32_t* q);
+
+private:
+    struct Page {
+        uint8_t data[PAGE_SIZE];
+        uint16_t length;
+        volatile bool busy;    // Owned by the writer until cleared
+    };
+    enum Command : uint8_t { OPEN, WRITE, CLOSE };
+    struct Message {
+        Command command;
+        uint8_t page;
+        RunInfo info;      // OPEN only
+    };
+
+    Page pages[2];
+    uint8_t activePage;
+    int32_t prev[NUM_FIELDS], prev2[NUM_FIELDS];
+    uint16_t pageRecords;
+    bool mounted;
+    bool active;
+    uint32_t nextRunId;
+    uint32_t dropped;
+    uint32_t bytes;
+    QueueHandle_t queue;
+
+    bool flushPage();
+    static void runPath(uint32_t runId, char* path, size_t size);
+    static void writerTask(void* arg);
+};
+
+extern RunRecorder runRecorder;
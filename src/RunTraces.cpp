@@ -0,0 +1,64 @@
+#include "RunTraces.h"
+
+#define COLOR_ENVELOPE  0x7BE0  // olive
+#define COLOR_SETPOINT  0x8000  // dark red
+#define COLOR_OUTPUT    TFT_DARKGREEN
+#define COLOR_MAIN      0x0210  // dim cyan
+#define COLOR_FRY       0x4008  // dim purple
+
+// Individual probes, when more than one is fitted
+static const uint16_t probeColors[ControlSample::MAX_PROBES] = {
+    TFT_CYAN, TFT_MAGENTA, TFT_ORANGE, TFT_PINK
+};
+
+void RunTraces::attach(Chart& target, uint16_t tempColor) {
+    chart = &target;
+    // Added in drawing order, so temperature ends up on top
+    fry = chart->addSeries(COLOR_FRY, Chart::AXIS_PERCENT);
+    main = chart->addSeries(COLOR_MAIN, Chart::AXIS_PERCENT);
+    output = chart->addSeries(COLOR_OUTPUT, Chart::AXIS_PERCENT);
+    for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+        probes[i] = chart->addSeries(probeColors[i], Chart::AXIS_VALUE);
+    }
+    setpoint = chart->addSeries(COLOR_SETPOINT, Chart::AXIS_VALUE);
+    temp = chart->addSeries(tempColor, Chart::AXIS_VALUE);
+}
+
+void RunTraces::plot(uint32_t timeMs, const ControlSample& sample) {
+    if (!chart) return;
+    chart->plot(fry, timeMs, sample.fryPWM * 10);
+    chart->plot(main, timeMs, sample.mainPWM * 10);
+    chart->plot(output, timeMs, Chart::tenths(sample.output));
+    chart->plot(setpoint, timeMs, Chart::tenths(sample.setpoint));
+    for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+        plotProbe(i, timeMs, ControlSample::probeTenths(sample.probes[i]));
+    }
+    chart->plot(temp, timeMs, fixedToTenths(sample.temp));
+}
+
+void RunTraces::plotProbe(uint8_t i, uint32_t timeMs, int16_t tenths) {
+    if (tenths == ControlSample::NO_READING_TENTHS) chart->breakLine(probes[i]);
+    else chart->plot(probes[i], timeMs, tenths);
+}
+
+void RunTraces::replayLayer(Chart& chart, void* context) {
+    RunTraces* traces = (RunTraces*)context;
+    if (traces->chart != &chart || runHistory.empty()) return;
+    runHistory.visit(drawBucket, traces);
+}
+
+void RunTraces::drawBucket(const HistoryStore::Bucket& bucket, void* context) {
+    RunTraces* traces = (RunTraces*)context;
+    Chart* chart = traces->chart;
+    uint32_t t = bucket.startMs + bucket.durationMs / 2;
+    // Buckets already hold tenths (temperatures) and whole percent (duties)
+    chart->bar(t, bucket.min, bucket.max, COLOR_ENVELOPE);
+    chart->plot(traces->fry, t, bucket.fryDuty * 10);
+    chart->plot(traces->main, t, bucket.mainDuty * 10);
+    chart->plot(traces->output, t, bucket.output * 10);
+    for (uint8_t i = 0; i < ControlSample::MAX_PROBES; ++i) {
+        traces->plotProbe(i, t, bucket.probes[i]);
+    }
+    chart->plot(traces->setpoint, t, bucket.setpoint);
+    chart->plot(traces->temp, t, bucket.mean);
+}
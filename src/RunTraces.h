@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Chart.h"
+#include "ControlSample.h"
+#include "HistoryStore.h"
+
+// The run's traces on a chart, shared by the oven and reflow screens:
+// element duties and controller output on the percent axis, then the
+// individual probes, setpoint and temperature on the value axis. Replays
+// draw the temperature's min-max envelope where runHistory has merged
+// samples into coarser buckets. A probe's trace breaks wherever it had no
+// reading.
+class RunTraces {
+public:
+    // Adds the series to chart; call after chart.begin()
+    void attach(Chart& chart, uint16_t tempColor);
+    // Plots one live sample at timeMs on the chart's time axis
+    void plot(uint32_t timeMs, const ControlSample& sample);
+    // Chart layer replaying runHistory; context is the RunTraces
+    static void replayLayer(Chart& chart, void* context);
+
+private:
+    Chart* chart = nullptr;
+    int8_t fry = -1, main = -1, output = -1, setpoint = -1, temp = -1;
+    int8_t probes[ControlSample::MAX_PROBES] = {-1, -1, -1, -1};
+
+    // Plots one probe's point (tenths), or breaks its line without one
+    void plotProbe(uint8_t i, uint32_t timeMs, int16_t tenths);
+
+    static void drawBucket(const HistoryStore::Bucket& bucket, void* context);
+};
@@ -0,0 +1,172 @@
+#include "SensorManager.h"
+
+// Readings outside this range are treated as a wiring fault
+#define PROBE_MIN (-40 * FIXED_TEMP_ONE)
+#define PROBE_MAX (400 * FIXED_TEMP_ONE)
+
+// MAX31856 registers (write address = read address | 0x80)
+#define MAX31856_REG_CR0 0x00
+#define MAX31856_REG_CR1 0x01
+#define MAX31856_CR0_50HZ 0x01
+#define MAX31856_CR1_AVGSEL_MASK 0x70
+#define MAX31856_CR1_AVGSEL_SHIFT 4
+#define MAX31856_REG_LTCBH 0x0C
+#define MAX31856_REG_SR 0x0F
+
+// Probes stop counting as healthy after this many missed sample periods
+#define STALE_PERIODS 3
+
+SensorManager::SensorManager(int8_t sck, int8_t miso, int8_t mosi)
+    : _sck(sck), _miso(miso), _mosi(mosi), _count(0), _healthy(0), _mode(BOARD_WEIGHTED), _fused(0),
+      _conversion{1, false}
+{}
+
+bool SensorManager::addProbe(const ProbeConfig& config) {
+    if (_count >= MAX_PROBES) return false;
+    Probe& p = _probes[_count++];
+    p.config = config;
+    p.device = nullptr;
+    p.regs = nullptr;
+    p.weight = (uint16_t)lroundf(constrain(config.weight, 0.0f, 255.0f) * 256);
+    p.temp = 0;
+    p.fault = 0;
+    p.healthy = false;
+    p.lastReadMs = 0;
+    return true;
+}
+
+void SensorManager::begin() {
+    for (uint8_t i = 0; i < _count; ++i) {
+        Probe& p = _probes[i];
+        if (!p.device) {
+            p.device = new Adafruit_MAX31856(p.config.cs, _mosi, _miso, _sck);
+            p.regs = new Adafruit_SPIDevice(p.config.cs, _sck, _miso, _mosi, 1000000,
+                                            SPI_BITORDER_MSBFIRST, SPI_MODE1);
+        }
+        p.device->begin();
+        p.device->setThermocoupleType(MAX31856_TCTYPE_K);
+        p.device->setNoiseFilter(MAX31856_NOISE_FILTER_50HZ);
+        p.device->setConversionMode(MAX31856_CONTINUOUS);
+        pinMode(p.config.drdy, INPUT);
+        p.regs->begin();
+    }
+    setConversion(_conversion);
+}
+
+uint8_t SensorManager::readRegister(Probe& probe, uint8_t reg) {
+    uint8_t value = 0;
+    probe.regs->write_then_read(&reg, 1, &value, 1);
+    return value;
+}
+
+void SensorManager::readRegisters(Probe& probe, uint8_t reg, uint8_t* buffer, uint8_t len) {
+    probe.regs->write_then_read(&reg, 1, buffer, len);
+}
+
+void SensorManager::writeRegister(Probe& probe, uint8_t reg, uint8_t value) {
+    uint8_t buffer[2] = {(uint8_t)(reg | 0x80), value};
+    probe.regs->write(buffer, 2);
+}
+
+bool SensorManager::setConversion(const Conversion& conversion) {
+    // AVGSEL: 0 = 1 sample, 1 = 2, 2 = 4, 3 = 8, 4 = 16
+    uint8_t avgsel = 0;
+    while (avgsel < 4 && (1u << avgsel) < conversion.averaging) avgsel++;
+    _conversion.averaging = 1u << avgsel;
+    _conversion.filter60Hz = conversion.filter60Hz;
+
+    bool written = false;
+    for (uint8_t i = 0; i < _count; ++i) {
+        Probe& p = _probes[i];
+        if (!p.regs) continue;
+        uint8_t cr1 = readRegister(p, MAX31856_REG_CR1);
+        cr1 = (cr1 & ~MAX31856_CR1_AVGSEL_MASK) | (avgsel << MAX31856_CR1_AVGSEL_SHIFT);
+        writeRegister(p, MAX31856_REG_CR1, cr1);
+        p.device->setNoiseFilter(_conversion.filter60Hz ? MAX31856_NOISE_FILTER_60HZ
+                                                        : MAX31856_NOISE_FILTER_50HZ);
+        written = true;
+    }
+    return written;
+}
+
+uint32_t SensorManager::samplePeriodMs() const {
+    // Datasheet continuous-mode conversion time: 98 ms (50 Hz) or 82 ms
+    // (60 Hz) for one sample, plus 40 or 33 ms per extra averaged sample
+    uint32_t extra = _conversion.averaging - 1;
+    return _conversion.filter60Hz ? 82 + extra * 100 / 3 : 98 + extra * 40;
+}
+
+bool SensorManager::poll(bool block) {
+    if (block) {
+        unsigned long startTime = millis();
+        bool ready = false;
+        uint32_t timeoutMs = samplePeriodMs() + 400;
+        while (!ready && (millis() - startTime < timeoutMs)) {
+            for (uint8_t i = 0; i < _count; ++i) {
+                if (digitalRead(_probes[i].config.drdy) == LOW) ready = true;
+            }
+            if (!ready) delay(10);
+        }
+    }
+
+    uint32_t nowMs = millis();
+    bool any = false;
+    for (uint8_t i = 0; i < _count; ++i) {
+        if (digitalRead(_probes[i].config.drdy) == LOW) {
+            readProbe(_probes[i], nowMs);
+            any = true;
+        }
+    }
+    fuse(nowMs);
+    return any;
+}
+
+void SensorManager::readProbe(Probe& probe, uint32_t nowMs) {
+    // Continuous mode: the latest conversion is in the registers, so read
+    // them directly rather than through the driver's float conversion
+    uint8_t ltcb[3];
+    readRegisters(probe, MAX31856_REG_LTCBH, ltcb, sizeof(ltcb));
+    FixedTemp t = fixedFromRegisters(ltcb);
+    probe.fault = readRegister(probe, MAX31856_REG_SR);
+    probe.lastReadMs = nowMs;
+    bool plausible = (t > PROBE_MIN) && (t < PROBE_MAX);
+    if (probe.fault == 0 && plausible) {
+        probe.temp = t;
+        if (!probe.healthy) Serial.printf("Probe %s online\n", probe.config.name);
+        probe.healthy = true;
+    } else {
+        if (probe.healthy) Serial.printf("Probe %s fault 0x%02X (%.1fC)\n", probe.config.name, probe.fault, fixedToC(t));
+        probe.healthy = false;
+    }
+}
+
+void SensorManager::fuse(uint32_t nowMs) {
+    int64_t weighted = 0;
+    uint32_t weights = 0;
+    FixedTemp hottest = 0;
+    uint8_t healthy = 0;
+    for (uint8_t i = 0; i < _count; ++i) {
+        Probe& p = _probes[i];
+        // A probe that has stopped converting counts as failed
+        if (p.healthy && (nowMs - p.lastReadMs) > STALE_PERIODS * samplePeriodMs() + 500) {
+            Serial.printf("Probe %s stale\n", p.config.name);
+            p.healthy = false;
+        }
+        if (!p.healthy) continue;
+        if (healthy == 0 || p.temp > hottest) hottest = p.temp;
+        weighted += (int64_t)p.weight * p.temp;
+        weights += p.weight;
+        healthy++;
+    }
+    _healthy = healthy;
+    // With nothing healthy, hold the last fused value. It's stale, so heating
+    // loops check TempValid() (i.e. allFaulted()) and cut the heat.
+    if (healthy == 0) return;
+
+    if (_mode == MAX_PROBE || weights == 0) {
+        _fused = hottest;
+    } else {
+        int64_t half = weights / 2;
+        _fused = (FixedTemp)((weighted + (weighted >= 0 ? half : -half)) / (int64_t)weights);
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_MAX31856.h>
+#include <Adafruit_SPIDevice.h>
+#include "FixedTemp.h"
+
+// Several MAX31856 thermocouple amplifiers sharing one software SPI bus, each
+// with its own chip select and DRDY line. Each probe is read when its DRDY
+// goes low, and the healthy probes are fused into one control temperature.
+// A probe that reports a fault, reads implausibly or stops converting drops
+// out of the fusion until it recovers. Readings are taken straight from the
+// temperature registers as FixedTemp.
+class SensorManager {
+public:
+    enum Role { AIR, BOARD };
+    enum FusionMode {
+        BOARD_WEIGHTED,   // Weighted mean of healthy probes
+        MAX_PROBE         // Hottest healthy probe
+    };
+
+    struct ProbeConfig {
+        const char* name;
+        int8_t cs;
+        int8_t drdy;
+        Role role;
+        float weight;     // Share in BOARD_WEIGHTED fusion
+    };
+
+    // Conversion settings applied to every probe. More averaging lowers
+    // noise by sqrt(samples) but lengthens the sample period.
+    struct Conversion {
+        uint8_t averaging;    // 1, 2, 4, 8 or 16 samples per reading
+        bool filter60Hz;      // Mains rejection; 60 Hz converts faster than 50 Hz
+    };
+
+    static const uint8_t MAX_PROBES = 4;
+
+    SensorManager(int8_t sck, int8_t miso, int8_t mosi);
+
+    bool addProbe(const ProbeConfig& config);
+    void begin();
+
+    // Reads every probe whose DRDY is low. With block, waits up to a sample
+    // period plus 400 ms for the first probe to become ready. Returns true if
+    // any probe was read.
+    bool poll(bool block = false);
+
+    // Writes the conversion settings to every probe. Returns false if none
+    // was written; the new sample period applies from the next reading.
+    bool setConversion(const Conversion& conversion);
+    const Conversion& conversion() const { return _conversion; }
+    // Time between readings in continuous mode for the current settings
+    uint32_t samplePeriodMs() const;
+
+    void setFusionMode(FusionMode mode) { _mode = mode; }
+    FusionMode fusionMode() const { return _mode; }
+    FixedTemp fused() const { return _fused; }
+    bool allFaulted() const { return _healthy == 0; }
+
+    uint8_t numProbes() const { return _count; }
+    const char* name(uint8_t i) const { return _probes[i].config.name; }
+    FixedTemp reading(uint8_t i) const { return _probes[i].temp; }
+    bool healthy(uint8_t i) const { return _probes[i].healthy; }
+    uint8_t fault(uint8_t i) const { return _probes[i].fault; }
+
+private:
+    struct Probe {
+        ProbeConfig config;
+        Adafruit_MAX31856* device;
+        // Register access for settings the Adafruit driver doesn't expose
+        Adafruit_SPIDevice* regs;
+        uint16_t weight;      // config.weight, 8.8 fixed point
+        FixedTemp temp;
+        uint8_t fault;
+        bool healthy;
+        uint32_t lastReadMs;
+    };
+
+    int8_t _sck, _miso, _mosi;
+    Probe _probes[MAX_PROBES];
+    uint8_t _count;
+    uint8_t _healthy;
+    FusionMode _mode;
+    FixedTemp _fused;
+    Conversion _conversion;
+
+    static uint8_t readRegister(Probe& probe, uint8_t reg);
+    static void readRegisters(Probe& probe, uint8_t reg, uint8_t* buffer, uint8_t len);
+    static void writeRegister(Probe& probe, uint8_t reg, uint8_t value);
+
+    void readProbe(Probe& probe, uint32_t nowMs);
+    void fuse(uint32_t nowMs);
+};
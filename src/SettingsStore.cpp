@@ -0,0 +1,126 @@
+#include "SettingsStore.h"
+
+SettingsStore::SettingsStore(const char* name, uint32_t idleMs)
+    : name(name), idleMs(idleMs), count(0), lastEditMs(0)
+{}
+
+int8_t SettingsStore::add(const char* key, void* data, uint16_t size, uint8_t version, Migrate migrate) {
+    if (count >= MAX_RECORDS || size > MAX_SIZE) return -1;
+    records[count] = {key, data, size, version, migrate, 0, false};
+    return count++;
+}
+
+void SettingsStore::load() {
+    prefs.begin(name, false);
+    for (uint8_t i = 0; i < count; ++i) loadRecord(records[i]);
+    prefs.end();
+}
+
+void SettingsStore::loadRecord(Record& r) {
+    uint8_t blob[sizeof(Header) + MAX_SIZE];
+    size_t length = prefs.getBytesLength(r.key);
+    if (length == 0) {
+        // Nothing stored in blob form yet
+        if (r.migrate && r.migrate(0, nullptr, 0, r.data, prefs)) {
+            Serial.printf("Settings: %s migrated from keys\n", r.key);
+            write(r);
+        }
+        return;
+    }
+
+    Header header;
+    if (length < sizeof(header) || length > sizeof(blob) || prefs.getBytes(r.key, blob, length) != length) {
+        Serial.printf("Settings: %s unreadable, using defaults\n", r.key);
+        r.dirty = true;
+        return;
+    }
+    memcpy(&header, blob, sizeof(header));
+    const uint8_t* payload = blob + sizeof(header);
+    if (header.size != length - sizeof(header) || crc32(payload, header.size) != header.crc) {
+        Serial.printf("Settings: %s failed CRC, using defaults\n", r.key);
+        r.dirty = true;
+        return;
+    }
+
+    if (header.version == r.version && header.size == r.size) {
+        memcpy(r.data, payload, r.size);
+        r.storedCrc = header.crc;
+    } else if (header.version < r.version && r.migrate &&
+               r.migrate(header.version, payload, header.size, r.data, prefs)) {
+        Serial.printf("Settings: %s migrated from v%u\n", r.key, header.version);
+        write(r);
+    } else {
+        Serial.printf("Settings: %s v%u not readable by v%u, using defaults\n",
+                      r.key, header.version, r.version);
+        r.dirty = true;
+    }
+}
+
+bool SettingsStore::stored(int8_t record) const {
+    return record >= 0 && record < count && records[record].storedCrc != 0;
+}
+
+void SettingsStore::markDirty(int8_t record) {
+    if (record < 0 || record >= count) return;
+    records[record].dirty = true;
+    lastEditMs = millis();
+}
+
+void SettingsStore::service(uint32_t nowMs) {
+    if (nowMs - lastEditMs < idleMs) return;
+    for (uint8_t i = 0; i < count; ++i) {
+        if (records[i].dirty) {
+            flush();
+            return;
+        }
+    }
+}
+
+void SettingsStore::flush() {
+    bool open = false, failed = false;
+    for (uint8_t i = 0; i < count; ++i) {
+        Record& r = records[i];
+        if (!r.dirty) continue;
+        // Edits that end up back where they started don't cost a write
+        if (crc32((const uint8_t*)r.data, r.size) == r.storedCrc) {
+            r.dirty = false;
+            continue;
+        }
+        if (!open && !failed) {
+            open = prefs.begin(name, false);
+            if (!open) Serial.printf("Settings: opening %s failed\n", name);
+        }
+        if (open && write(r)) r.dirty = false;
+        else failed = true;
+    }
+    if (open) prefs.end();
+    // Failed records stay dirty; retry after another idle period rather
+    // than on every service()
+    if (failed) lastEditMs = millis();
+}
+
+bool SettingsStore::write(Record& r) {
+    uint8_t blob[sizeof(Header) + MAX_SIZE];
+    Header header = {r.version, 0, r.size, crc32((const uint8_t*)r.data, r.size)};
+    memcpy(blob, &header, sizeof(header));
+    memcpy(blob + sizeof(header), r.data, r.size);
+    if (prefs.putBytes(r.key, blob, sizeof(header) + r.size) != sizeof(header) + r.size) {
+        Serial.printf("Settings: writing %s failed\n", r.key);
+        return false;
+    }
+    r.storedCrc = header.crc;
+    Serial.printf("Settings: saved %s\n", r.key);
+    return true;
+}
+
+uint32_t SettingsStore::crc32(const uint8_t* data, size_t len) {
+    // CRC-32 (IEEE), bitwise: records are small and written rarely
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Keeps settings in NVS as one binary blob per record rather than one key
+// per value. Each blob carries the record's schema version, its size and a
+// CRC-32 of the payload, so a torn or stale write is detected and the
+// compiled-in defaults are kept instead (and stored at the next write).
+//
+// Edits only mark a record dirty. service() writes dirty records once the
+// settings have been left alone for idleMs, and only if the payload differs
+// from what was last stored, so a burst of menu edits costs one write.
+//
+// Blob layout: Header, then size bytes of the record's data as-is.
+class SettingsStore {
+public:
+    // Fills a record from an older schema. fromVersion 0 means no blob was
+    // stored, e.g. settings saved as separate keys by older firmware, which
+    // can be read through prefs. Returns false to keep the defaults.
+    typedef bool (*Migrate)(uint8_t fromVersion, const uint8_t* old, uint16_t oldSize,
+                            void* data, Preferences& prefs);
+
+    static const uint8_t MAX_RECORDS = 4;
+    static const uint16_t MAX_SIZE = 256;
+
+    SettingsStore(const char* name, uint32_t idleMs);
+
+    // Registers a record. data holds the defaults until load(). Returns the
+    // record's index, or -1 if the store is full or the record too big.
+    int8_t add(const char* key, void* data, uint16_t size, uint8_t version, Migrate migrate = nullptr);
+
+    // Reads every record. Migrated records are written back straight away.
+    void load();
+    // True once the record is held in NVS in the current schema
+    bool stored(int8_t record) const;
+
+    void markDirty(int8_t record);
+    // Writes dirty records after idleMs without further edits
+    void service(uint32_t nowMs);
+    // Writes dirty records now. Any that fail stay dirty, and service()
+    // tries them again after another idleMs.
+    void flush();
+
+private:
+    struct Header {
+        uint8_t version;
+        uint8_t reserved;
+        uint16_t size;
+        uint32_t crc;
+    } __attribute__((packed));
+
+    struct Record {
+        const char* key;
+        void* data;
+        uint16_t size;
+        uint8_t version;
+        Migrate migrate;
+        uint32_t storedCrc;   // CRC of the payload in NVS, 0 = none
+        bool dirty;
+    };
+
+    const char* name;
+    uint32_t idleMs;
+    Record records[MAX_RECORDS];
+    uint8_t count;
+    uint32_t lastEditMs;
+    Preferences prefs;
+
+    void loadRecord(Record& record);
+    bool write(Record& record);
+    static uint32_t crc32(const uint8_t* data, size_t len);
+};
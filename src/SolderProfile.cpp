@@ -3,78 +3,198 @@
 
 #define PHASE_MS(x) ((x) * 1000)
 
-static const SolderProfileParams defaultProfile = {
-    {
-        {"Preheat",   0, 150, PHASE_MS(180), PHASE_MS(180), false},
-        {"Soak",    150, 180, PHASE_MS(120), PHASE_MS(120), false},
-        {"Peak",    180, 235, PHASE_MS( 70), PHASE_MS(120), false},
-        {"Dwell",   235, 235, PHASE_MS( 30), PHASE_MS( 20), false},
-        {"Cool",    220,   0, PHASE_MS( 90), PHASE_MS( 90), false}
-    },
-    5
+// Assumed start temperature until startReflow() measures the real one
+#define DEFAULT_START_TEMP 25.0f
+
+// Most the setpoint slope may change per second at a phase corner, in C/s^2
+#define DEFAULT_CORNER_ACCEL 0.05f
+
+// Hold the ramp while more than 5C behind it, stretching a phase by up to 60s
+static const SolderProfile::ClockConfig defaultClockConfig = { 5.0f, 0.0f, PHASE_MS(60), true };
+
+static const ProfileSegment defaultProfile[] = {
+    // name       target  duration        rate  min            max
+    {"Preheat",   150,    PHASE_MS(180),  0,    0,             0,             false},
+    {"Soak",      180,    PHASE_MS(120),  0,    0,             0,             false},
+    {"Peak",      235,    PHASE_MS( 70),  0,    0,             PHASE_MS(120), false},
+    {"Dwell",     235,    PHASE_MS( 30),  0,    0,             0,             false},
+    {"Cool",        0,    PHASE_MS( 90),  0,    0,             PHASE_MS( 90), false}
 };
 
 SolderProfile::SolderProfile()
-    : SolderProfile(defaultProfile)
+    : SolderProfile(defaultProfile, sizeof(defaultProfile) / sizeof(defaultProfile[0]))
 {}
 
-SolderProfile::SolderProfile(const SolderProfileParams& params)
-    : tftRef(nullptr),
-      graphX(0), graphY(0), graphW(0), graphH(0),
-      graphMinTemp(0), graphMaxTemp(0), graphTotalTime(0),
-      phaseIdx(PREHEAT),
-      numPhases(0)
+SolderProfile::SolderProfile(const ProfileSegment* segments, uint8_t count)
+    : phases(nullptr),
+      numPhases(0),
+      phaseCapacity(0),
+      phaseIdx(0),
+      clockConfig(defaultClockConfig),
+      cornerAccel(DEFAULT_CORNER_ACCEL),
+      profileSeries(-1),
+      reflowStartTime(0), lastClockMs(0), profileMs(0)
 {
-    setProfile(params);
+    setProfile(segments, count);
 }
 
-void SolderProfile::setProfile(const SolderProfileParams& params) {
-    numPhases = params.numPhases;
-    if(numPhases > SOLDER_PROFILE_MAX_PHASES) numPhases = SOLDER_PROFILE_MAX_PHASES;
-    for(uint8_t i = 0; i < numPhases; ++i) {
-        const auto& p = params.phases[i];
-        phases[i] = Phase(p.phaseName, p.startTemp, p.endTemp, p.minTimeMs, p.maxTimeMs, p.maxRate);
+SolderProfile::~SolderProfile() {
+    delete[] phases;
+}
+
+void SolderProfile::setClockConfig(const ClockConfig& config) {
+    // Phase guards are resolved from it by the next startReflow()
+    clockConfig = config;
+}
+
+void SolderProfile::setCornerSmoothing(float maxAccel) {
+    cornerAccel = maxAccel;
+    compileTrajectory();
+}
+
+void SolderProfile::setProfile(const ProfileSegment* segments, uint8_t count) {
+    if (count > phaseCapacity) {
+        delete[] phases;
+        phases = new Phase[count];
+        phaseCapacity = count;
+    }
+    numPhases = count;
+    for (uint8_t i = 0; i < numPhases; ++i) {
+        phases[i].spec = segments[i];
     }
-    phaseIdx = PREHEAT;
-    // Optionally, reset graph/reflow state here if needed
+    phaseIdx = 0;
+    resolvePhases(DEFAULT_START_TEMP);
+    compileTrajectory();
 }
 
-void SolderProfile::startReflow() {
-    reflowStartTime = millis();
-    phaseIdx = PREHEAT;
+// Works out each phase's start temperature, ramp time and guards from its
+// spec, chaining from startTemp through the previous phase's target.
+void SolderProfile::resolvePhases(float startTemp) {
+    float prevTemp = startTemp;
     for (uint8_t i = 0; i < numPhases; ++i) {
-        phases[i].startTimeMs = 0;
-        phases[i].completed = false;
+        Phase& phase = phases[i];
+        const ProfileSegment& spec = phase.spec;
+
+        phase.phaseName = spec.name;
+        phase.startTemp = prevTemp;
+        phase.endTemp = spec.targetTemp;
+        phase.maxRate = spec.maxRate;
+
+        phase.durationMs = spec.durationMs;
+        if (phase.durationMs == 0 && spec.rateCPerSec > 0) {
+            phase.durationMs = (uint32_t)(fabsf(phase.endTemp - phase.startTemp) / spec.rateCPerSec * 1000.0f);
+        }
+
+        phase.minTimeMs = spec.minTimeMs ? spec.minTimeMs : phase.durationMs;
+        phase.maxTimeMs = spec.maxTimeMs ? spec.maxTimeMs : phase.durationMs + clockConfig.maxHoldMs;
+        if (phase.maxTimeMs < phase.minTimeMs) phase.maxTimeMs = phase.minTimeMs;
+
+        // Within 2% of the phase's span counts as reached, from whichever
+        // side we approach. Holds have no span, so they use 2% of the target.
+        float span = fabsf(phase.endTemp - phase.startTemp);
+        float band = 0.02f * (span > 0 ? span : fabsf(phase.endTemp));
+        if (phase.endTemp < phase.startTemp) {
+            phase.achievedTemp = phase.endTemp + band;
+        } else {
+            phase.achievedTemp = phase.endTemp - band;
+        }
+
+        phase.startTimeMs = 0;
+        phase.completed = false;
+        prevTemp = phase.endTemp;
     }
-    if(numPhases > 0)
-        phases[0].startTimeMs = reflowStartTime;
 }
 
-void SolderProfile::initGraph(TFT_eSPI& tft, int x, int y, int w, int h) {
-    tftRef = &tft;
-    graphX = x;
-    graphY = y;
-    graphW = w;
-    graphH = h;
-
-    // Calculate and store min/max temp and total time for scaling
-    graphMinTemp = 0;
-    graphMaxTemp = (numPhases > 0) ? phases[0].startTemp : 0;
-    graphTotalTime = 0;
+void SolderProfile::compileTrajectory() {
+    traj.reserve(numPhases);
+    traj.clear();
+    for (uint8_t i = 0; i < numPhases; ++i) {
+        traj.addSegment(i, phases[i].durationMs, phases[i].startTemp, phases[i].endTemp);
+        phases[i].trajEndMs = traj.totalTimeMs();
+    }
+    traj.smoothCorners(cornerAccel);
+}
+
+uint32_t SolderProfile::startReflow(float startTemp, bool warmStart) {
+    // A warm start keeps the nominal profile and joins it part way up
+    resolvePhases(warmStart ? DEFAULT_START_TEMP : startTemp);
+    compileTrajectory();
+
+    uint32_t nowMs = millis();
+    uint32_t joinMs = warmStart ? joinTime(startTemp) : 0;
+    // Shift the start so the graph plots against profile time
+    reflowStartTime = nowMs - joinMs;
+    runHistory.reset(reflowStartTime);
+    lastClockMs = nowMs;
+    profileMs = joinMs;
+    phaseIdx = 0;
     for (uint8_t i = 0; i < numPhases; ++i) {
-        graphTotalTime += phases[i].minTimeMs;
-        if (phases[i].startTemp < graphMinTemp) graphMinTemp = phases[i].startTemp;
-        if (phases[i].endTemp < graphMinTemp) graphMinTemp = phases[i].endTemp;
-        if (phases[i].startTemp > graphMaxTemp) graphMaxTemp = phases[i].startTemp;
-        if (phases[i].endTemp > graphMaxTemp) graphMaxTemp = phases[i].endTemp;
+        uint32_t phaseStartMs = (i > 0) ? phases[i - 1].trajEndMs : 0;
+        if (joinMs >= phases[i].trajEndMs && i + 1 < numPhases) {
+            phases[i].completed = true;
+            continue;
+        }
+        phaseIdx = i;
+        phases[i].startTimeMs = nowMs - (joinMs - phaseStartMs);
+        break;
+    }
+    return joinMs;
+}
+
+// Earliest point on the rising part of the trajectory at or above temp.
+// Returns 0 if the oven is colder than the start or hotter than the peak.
+uint32_t SolderProfile::joinTime(float temp) const {
+    for (uint8_t i = 0; i < traj.numSegments(); ++i) {
+        const ReflowTrajectory::Segment& seg = traj.segment(i);
+        if (ReflowTrajectory::valueIn(seg, seg.endMs) < seg.startTemp) break;
+        if (seg.startTemp >= temp) return seg.startMs;
+        if (ReflowTrajectory::valueIn(seg, seg.endMs) < temp) continue;
+
+        // Segments rise monotonically, so bisect for the crossing
+        uint32_t lo = seg.startMs, hi = seg.endMs;
+        while (hi - lo > 100) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (ReflowTrajectory::valueIn(seg, mid) < temp) lo = mid;
+            else hi = mid;
+        }
+        return hi;
+    }
+    return 0;
+}
+
+void SolderProfile::initGraph(TFT_eSPI& tft, int x, int y, int w, int h) {
+    // Scale to the compiled profile, in tenths
+    int32_t minTemp = 0;
+    int32_t maxTemp = (traj.numSegments() > 0) ? Chart::tenths(traj.segment(0).startTemp) : 0;
+    for (uint8_t i = 0; i < traj.numSegments(); ++i) {
+        const ReflowTrajectory::Segment& seg = traj.segment(i);
+        int32_t startT = Chart::tenths(seg.startTemp);
+        int32_t endT = Chart::tenths(ReflowTrajectory::valueIn(seg, seg.endMs));
+        if (startT < minTemp) minTemp = startT;
+        if (endT < minTemp) minTemp = endT;
+        if (startT > maxTemp) maxTemp = startT;
+        if (endT > maxTemp) maxTemp = endT;
     }
-    graphTotalTime += 60000;
-    graphMaxTemp += 25;
-    if (graphMaxTemp == graphMinTemp) graphMaxTemp += 1;
+
+    chart.begin(tft, x, y, w, h);
+    // A stretched profile or an overshoot grows the axes instead of
+    // dropping points off the edge
+    chart.setValueAxis({minTemp, maxTemp + 250, Chart::EXTEND, 100, 100, "c"});
+    chart.setTimeAxis({traj.totalTimeMs() + 60000, Chart::EXTEND, 60000, Chart::LABEL_SECONDS});
+    profileSeries = chart.addSeries(TFT_RED, Chart::AXIS_VALUE);
+    chart.addLayer(drawProfile, this);
+    traces.attach(chart, TFT_YELLOW);
+    chart.addLayer(RunTraces::replayLayer, &traces);
 }
 
-void SolderProfile::update(float actualTemp, float output) {
-    unsigned long nowMs = millis();
+// Advances the profile clock and the phase state machine. The clock runs at
+// wall speed while the oven keeps up, holds while it lags a ramp by more than
+// holdBandC, waits at the end of a phase until its temperature is reached and
+// jumps to the end of a phase that has already been achieved. The phase's
+// maxTimeMs bounds how far it can be stretched.
+void SolderProfile::update(uint32_t nowMs, float actualTemp) {
+    uint32_t dt = nowMs - lastClockMs;
+    lastClockMs = nowMs;
     if (phaseIdx == COMPLETE) return;
     if (phaseIdx >= numPhases) {
         phaseIdx = COMPLETE;
@@ -86,52 +206,57 @@ void SolderProfile::update(float actualTemp, float output) {
         phase.startTimeMs = nowMs;
 
     uint32_t elapsed = nowMs - phase.startTimeMs;
+    bool tempReached = (phase.endTemp < phase.startTemp) ? (actualTemp <= phase.achievedTemp)
+                                                         : (actualTemp >= phase.achievedTemp);
+    bool minTimeReached = (elapsed >= phase.minTimeMs);
+    bool maxTimeExceeded = (elapsed >= phase.maxTimeMs);
 
-    // --- Plot actual temperature on the graph ---
-    if (tftRef && graphW > 0 && graphH > 0) {
-        uint32_t totalTime = graphTotalTime;
-        float minTemp = graphMinTemp;
-        float maxTemp = graphMaxTemp;
-
-        // Calculate elapsed time since reflow started
-        uint32_t profileElapsed = nowMs - reflowStartTime;
-        
-        int px = graphX + (int)((profileElapsed * graphW) / totalTime);
-        int py = graphY + graphH - (int)((actualTemp - minTemp) * graphH / (maxTemp - minTemp));
-        if (px >= graphX && px < graphX + graphW && py >= graphY && py < graphY + graphH) {
-            tftRef->drawPixel(px, py, TFT_YELLOW);
-            if( elapsed < 100) {
-                tftRef->drawRect(px-2,py-2, 5,5, TFT_YELLOW);
-            }
-        }
-
-        // Draw a line for the output value
-        tftRef->drawPixel(px, (graphY + graphH) - (output/4), TFT_DARKGREEN);
-
-        // Print phase and actual temperature at the top of the screen
-        TFT_eSPI& tft = *tftRef;
-        tft.setTextColor(TFT_NAVY, TFT_BLACK);
-        tft.setTextSize(1);
-        tft.setCursor(0, 0);
-        //tft.printf("%s T:%.0fC      ", phase.phaseName, actualTemp);
+    // How far the oven trails the ramp, in the direction of travel
+    ReflowTrajectory::Sample now = traj.sample(profileMs, 0);
+    float lag = 0;
+    if (now.slope > 0) lag = now.setpoint - actualTemp;
+    else if (now.slope < 0) lag = actualTemp - now.setpoint;
 
+    uint32_t step = dt;
+    if (lag > clockConfig.holdBandC) {
+        step = (uint32_t)(dt * clockConfig.holdRate);
     }
-    // --- End plot actual temp ---
-
-    bool tempReached = (actualTemp >= phase.achievedTemp);
-    bool minTimeReached = (elapsed >= phase.minTimeMs);
-    bool maxTimeExceeded = (elapsed >= phase.maxTimeMs);
+    profileMs += step;
 
-    if ((tempReached && minTimeReached) || maxTimeExceeded) {
+    if (maxTimeExceeded || (clockConfig.allowSkip && tempReached && minTimeReached)) {
+        // Out of time, or already there: move the clock to the next phase
+        if (profileMs < phase.trajEndMs) profileMs = phase.trajEndMs;
         phase.completed = true;
-        nextPhase(nowMs);        
+        nextPhase(nowMs);
+    } else if (profileMs >= phase.trajEndMs) {
+        if (tempReached && minTimeReached) {
+            phase.completed = true;
+            nextPhase(nowMs);
+        } else {
+            // Hold the setpoint at the end of this phase until the oven catches up
+            profileMs = (phase.trajEndMs > 0) ? phase.trajEndMs - 1 : 0;
+        }
     }
+}
+
+void SolderProfile::plot(uint32_t nowMs, const ControlSample& sample) {
+    if (phaseIdx == COMPLETE || phaseIdx >= numPhases) return;
+    Phase& phase = phases[phaseIdx];
+    uint32_t elapsed = nowMs - phase.startTimeMs;
+    runHistory.add(nowMs, sample);
 
+    // Plot against elapsed time since reflow started
+    uint32_t profileElapsed = nowMs - reflowStartTime;
+    traces.plot(profileElapsed, sample);
+    if (elapsed < 100) {
+        chart.marker(profileElapsed, fixedToTenths(sample.temp), TFT_YELLOW, 5);
+    }
 }
 
 void SolderProfile::nextPhase(uint32_t nowMs) {
     if (phaseIdx + 1 < numPhases) {
-        phaseIdx = static_cast<PhaseType>(phaseIdx + 1);
+        phaseIdx++;
+        phases[phaseIdx].startTimeMs = nowMs;
     } else {
         phaseIdx = COMPLETE;
     }
@@ -145,128 +270,49 @@ bool SolderProfile::isComplete() const {
     return phaseIdx == COMPLETE;
 }
 
+bool SolderProfile::isCooling() const {
+    if (phaseIdx == COMPLETE || phaseIdx >= numPhases) return false;
+    return phases[phaseIdx].endTemp < phases[phaseIdx].startTemp;
+}
+
 // Must call initGraph before drawGraph
 void SolderProfile::drawGraph() {
-    if (!tftRef || graphW <= 0 || graphH <= 0) return;
-    TFT_eSPI& tft = *tftRef;
-    uint32_t totalTime = graphTotalTime;
-    float minTemp = graphMinTemp;
-    float maxTemp = graphMaxTemp;
-
-    // Draw axes
-    tft.drawRect(graphX, graphY, graphW, graphH, TFT_NAVY);
-
-    // Draw horizontal grid lines and temperature labels (every 50 deg)
-    int tempStep = 50;
-    for (int temp = ((int)minTemp / tempStep) * tempStep; temp <= (int)maxTemp; temp += tempStep) {
-        int py = graphY + graphH - (int)((temp - minTemp) * graphH / (maxTemp - minTemp));
-        if( (temp % 100) == 0) {
-            tft.drawFastHLine(graphX, py, graphW, TFT_NAVY);
-        } else {
-            tft.drawFastHLine(graphX, py, graphW, 0x0008);
-        }
-        tft.setTextColor(TFT_NAVY, TFT_BLACK);
-        if( ((temp % 100) == 0) and (temp > 0)) {
-            tft.setTextSize(1);
-            tft.setCursor(graphX+4, py-4);
-            tft.printf("%3dc", temp);
-        }
-    }
+    chart.redraw();
+}
 
-    // Draw vertical grid lines for each 60s interval
-    uint32_t secondsTotal = totalTime / 1000;
-    for (uint32_t sec = 60; sec < secondsTotal; sec += 60) {
-        int px = graphX + (int)((sec * 1000UL * graphW) / totalTime);
-        tft.setTextColor(TFT_NAVY, TFT_BLACK);
-        if( sec % 120 == 0) {
-            tft.drawFastVLine(px, graphY, graphH, TFT_NAVY);
-            tft.setTextSize(1);
-            tft.setCursor(px - 10, graphY + graphH - 12);
-            tft.printf("%lus", sec);
-        } else {
-            tft.drawFastVLine(px, graphY, graphH, 0x0008);
+// Chart layer: the profile line from the compiled trajectory, with phase
+// change markers
+void SolderProfile::drawProfile(Chart& chart, void* context) {
+    SolderProfile* profile = (SolderProfile*)context;
+    const ReflowTrajectory& traj = profile->traj;
+    const int curveStepPx = 4;
+    int width = chart.timeToX(chart.spanMs()) - chart.timeToX(0);
+    chart.plot(profile->profileSeries, 0, Chart::tenths(traj.valueAt(0)));
+    for (uint8_t i = 0; i < traj.numSegments(); ++i) {
+        const ReflowTrajectory::Segment& seg = traj.segment(i);
+        // Straight segments need only their end point, curved ones are stepped
+        uint32_t stepMs = (seg.curvature == 0.0f && seg.cubic == 0.0f) ? (seg.endMs - seg.startMs) : (curveStepPx * chart.spanMs()) / (width > 0 ? width : 1);
+        if (stepMs == 0) stepMs = 1;
+        for (uint32_t t = seg.startMs + stepMs; ; t += stepMs) {
+            if (t > seg.endMs) t = seg.endMs;
+            chart.plot(profile->profileSeries, t, Chart::tenths(ReflowTrajectory::valueIn(seg, t)));
+            if (t >= seg.endMs) break;
         }
-    }
-
-    // Draw profile line and phase change circles
-    uint32_t elapsed = 0;
-    int prevX = graphX, prevY = graphY + graphH - (int)(((numPhases > 0 ? phases[0].startTemp : 0) - minTemp) * graphH / (maxTemp - minTemp));
-    for (uint8_t i = 0; i < numPhases; ++i) {
-        elapsed += phases[i].minTimeMs;
-        int px = graphX + (int)((elapsed * graphW) / totalTime);
-        int py = graphY + graphH - (int)((phases[i].endTemp - minTemp) * graphH / (maxTemp - minTemp));
-        tft.drawLine(prevX, prevY, px, py, TFT_RED);
-
-        if(i < numPhases-1) {
-            tftRef->drawRect(px-1,py-1, 3,3, TFT_RED);
-        }   
-        prevX = px;
-        prevY = py;
-    }
-}
 
-float SolderProfile::getIdealTemp() {
-    uint32_t nowMs = millis();
-    uint32_t elapsed = nowMs - reflowStartTime;
-    uint32_t phaseStart = 0;
-    for (uint8_t i = 0; i < numPhases; ++i) {
-        uint32_t phaseEnd = phaseStart + phases[i].minTimeMs;
-        if (elapsed <= phaseEnd) {
-            float t = (float)(elapsed - phaseStart) / (float)(phases[i].minTimeMs);
-            if (t < 0) t = 0;
-            if (t > 1) t = 1;
-            return phases[i].startTemp + t * (phases[i].endTemp - phases[i].startTemp);
+        if (i + 1 < traj.numSegments() && traj.segment(i + 1).phase != seg.phase) {
+            chart.marker(seg.endMs, Chart::tenths(ReflowTrajectory::valueIn(seg, seg.endMs)), TFT_RED, 3);
         }
-        phaseStart = phaseEnd;
     }
-    return (numPhases > 0) ? phases[numPhases-1].endTemp : 0;
 }
 
-float SolderProfile::getSetpoint() {
-    if (phaseIdx == COMPLETE || numPhases == 0) return (numPhases > 0) ? phases[numPhases-1].endTemp : 0;
-    Phase& phase = phases[phaseIdx];
-    if (phase.maxRate) {
-        return phase.endTemp;
-    } else {
-        return getIdealTemp();
+ReflowTrajectory::Sample SolderProfile::sample(uint32_t lookaheadMs) const {
+    ReflowTrajectory::Sample s = traj.sample(profileMs, lookaheadMs);
+    if (phaseIdx == COMPLETE || numPhases == 0) {
+        s.setpoint = (numPhases > 0) ? phases[numPhases-1].endTemp : 0;
+    } else if (phases[phaseIdx].maxRate) {
+        s.setpoint = phases[phaseIdx].endTemp;
     }
+    return s;
 }
 
-float SolderProfile::getFeedForwardSlope(uint32_t deltaMs) {
-    uint32_t nowMs = millis();
-    uint32_t elapsed = nowMs - reflowStartTime + deltaMs;
-    uint32_t phaseStart = 0;
-    int phaseIdxAtTime = -1;
-
-    for (uint8_t i = 0; i < numPhases; ++i) {
-        uint32_t phaseEnd = phaseStart + phases[i].minTimeMs;
-        if (elapsed < phaseEnd) {
-            phaseIdxAtTime = i;
-            break;
-        }
-        phaseStart = phaseEnd;
-    }
-
-    if (phaseIdxAtTime == -1) {
-        phaseIdxAtTime = (numPhases > 0) ? numPhases-1 : 0;
-    }
-
-    if (phaseIdxAtTime+1 < numPhases) {
-        uint32_t phaseEnd = 0;
-        for (int i = 0; i <= phaseIdxAtTime; ++i) {
-            phaseEnd += phases[i].minTimeMs;
-        }
-        if (elapsed == phaseEnd && phaseIdxAtTime+1 < numPhases) {
-            phaseIdxAtTime++;
-        }
-    }
-
-    const Phase& phase = phases[phaseIdxAtTime];
-    float slope = 0.0f;
-    if (phase.minTimeMs > 0) {
-        slope = (phase.endTemp - phase.startTemp) / ((float)phase.minTimeMs / 1000.0f);
-    }
-    return slope;
-};
-
 SolderProfile solderProfile;
\ No newline at end of file
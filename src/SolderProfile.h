@@ -2,73 +2,115 @@
 
 #include <stdint.h>
 #include <TFT_eSPI.h>
+#include "ReflowTrajectory.h"
+#include "ControlSample.h"
+#include "Chart.h"
+#include "RunTraces.h"
 
-#define SOLDER_PROFILE_MAX_PHASES 5
-
-struct SolderProfileParams {
-    struct PhaseParam {
-        const char* phaseName;
-        float startTemp;
-        float endTemp;
-        uint32_t minTimeMs;
-        uint32_t maxTimeMs;
-        bool maxRate;
-    };
-    PhaseParam phases[SOLDER_PROFILE_MAX_PHASES];
-    uint8_t numPhases;
+// One segment of a reflow profile as published by a paste vendor: a target
+// temperature reached either over a fixed duration or at a ramp rate, with
+// optional guards on how long the phase may run.
+struct ProfileSegment {
+    const char* name;
+    float targetTemp;      // Temperature at the end of the segment
+    uint32_t durationMs;   // Ramp/hold time, or 0 to derive it from rateCPerSec
+    float rateCPerSec;     // Ramp rate magnitude, used when durationMs is 0
+    uint32_t minTimeMs;    // Phase can't complete before this (0 = the ramp time)
+    uint32_t maxTimeMs;    // Phase is forced on after this (0 = the ramp time)
+    bool maxRate;          // Drive straight at targetTemp instead of following the ramp
 };
 
 class SolderProfile {
 public:
-    enum PhaseType { PREHEAT, SOAK, PEAK, DWELL, COOL, COMPLETE };
+    typedef uint8_t PhaseType;
+    static const PhaseType COMPLETE = 0xFF;
+
+    // How the profile clock follows a lagging or leading oven
+    struct ClockConfig {
+        float holdBandC;      // Lag behind a ramp before the clock is held
+        float holdRate;       // Clock speed while held (0 = stopped, 1 = wall time)
+        uint32_t maxHoldMs;   // Default stretch allowed per phase when its spec has no maxTimeMs
+        bool allowSkip;       // Jump ahead once a phase's temperature and minTimeMs are met
+    };
 
     struct Phase {
+        ProfileSegment spec;
+        // Resolved from spec and the previous phase by startReflow()
         const char* phaseName;
         float startTemp;
         float endTemp;
         float achievedTemp;
+        uint32_t durationMs;
         uint32_t minTimeMs;
         uint32_t maxTimeMs;
         uint32_t startTimeMs;
+        uint32_t trajEndMs;   // Profile time at which the phase ends
         bool maxRate;
         bool completed;
-
-        Phase(const char* name, float s, float e, float minT, float maxT, bool maxR = false)
-            : phaseName(name), startTemp(s), endTemp(e), achievedTemp(e*0.98), minTimeMs(minT), maxTimeMs(maxT), startTimeMs(0), maxRate(maxR), completed(false) {}
-        Phase() : phaseName(""), startTemp(0), endTemp(0), achievedTemp(0), minTimeMs(0), maxTimeMs(0), startTimeMs(0), maxRate(false), completed(false) {}
     };
 
     SolderProfile();
-    SolderProfile(const SolderProfileParams& params);
-    void setProfile(const SolderProfileParams& params);
+    SolderProfile(const ProfileSegment* segments, uint8_t count);
+    ~SolderProfile();
+    // Copies the segments; phase storage grows to fit the longest profile loaded
+    void setProfile(const ProfileSegment* segments, uint8_t count);
 
-    void startReflow();
-    void update(float actualTemp, float output);
+    // Takes effect at the next startReflow(); a run in progress keeps the
+    // guards it started with
+    void setClockConfig(const ClockConfig& config);
+    // Limit on the setpoint's rate change (C/s^2) used to round phase
+    // corners; 0 keeps the trajectory piecewise linear
+    void setCornerSmoothing(float maxAccel);
+
+    // Compiles the trajectory starting from startTemp and starts the clock.
+    // With warmStart the nominal profile is kept and the clock joins it where
+    // the setpoint first reaches startTemp. Returns the profile time joined at.
+    uint32_t startReflow(float startTemp, bool warmStart = false);
+    // Advances the profile clock and phase from the current temperature.
+    // Call once per control tick before sample().
+    void update(uint32_t nowMs, float actualTemp);
+    // Records the sample in runHistory and plots its temperature and output
+    void plot(uint32_t nowMs, const ControlSample& sample);
     PhaseType currentPhase() const;
     bool isComplete() const;
-    float getIdealTemp();
-    float getSetpoint();
-    float getFeedForwardSlope(uint32_t deltaMs);
+    // True while the current phase ramps down
+    bool isCooling() const;
+    // Setpoint and feed-forward slopes at the current profile time
+    ReflowTrajectory::Sample sample(uint32_t lookaheadMs) const;
+    uint32_t profileTimeMs() const { return profileMs; }
+    const ReflowTrajectory& trajectory() const { return traj; }
 
     // Must call initGraph before drawGraph
     void initGraph(TFT_eSPI& tft, int x, int y, int w, int h);
     void drawGraph();
 
-    Phase phases[SOLDER_PROFILE_MAX_PHASES];
+    Phase* phases;
     uint8_t numPhases;
 private:
+    SolderProfile(const SolderProfile&) = delete;
+    SolderProfile& operator=(const SolderProfile&) = delete;
+
+    uint8_t phaseCapacity;
     PhaseType phaseIdx;
+    ClockConfig clockConfig;
+    float cornerAccel;
     void nextPhase(uint32_t nowMs);
+    void resolvePhases(float startTemp);
+    uint32_t joinTime(float temp) const;
+    void compileTrajectory();
+
+    ReflowTrajectory traj;
 
     // --- Graph state ---
-    TFT_eSPI* tftRef = nullptr;
-    int graphX = 0, graphY = 0, graphW = 0, graphH = 0;
-    float graphMinTemp = 0;
-    float graphMaxTemp = 0;
-    uint32_t graphTotalTime = 0;
+    Chart chart;
+    RunTraces traces;
+    int8_t profileSeries;
+    static void drawProfile(Chart& chart, void* context);
 
     // --- Reflow timing ---
     uint32_t reflowStartTime = 0;
+    uint32_t lastClockMs = 0;
+    uint32_t profileMs = 0;   // Profile clock, stretched/skipped to follow the oven
 };
 
 extern SolderProfile solderProfile;
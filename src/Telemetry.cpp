@@ -0,0 +1,75 @@
+#include "Telemetry.h"
+
+Telemetry telemetry;
+
+Telemetry::Telemetry()
+    : _mode(TEXT), _seq(0), _dropped(0), _head(0), _tail(0)
+{}
+
+static inline int16_t scaled(float value, float scale) {
+    float v = value * scale;
+    v = v < 0 ? v - 0.5f : v + 0.5f;
+    return (int16_t)constrain(v, -32768.0f, 32767.0f);
+}
+
+uint16_t Telemetry::freeSpace() const {
+    return (uint16_t)((_tail - _head - 1 + RING_SIZE) % RING_SIZE);
+}
+
+void Telemetry::send(const ControlSample& sample) {
+    if (_mode != BINARY) return;
+
+    uint8_t raw[sizeof(TelemetryFrame) + 2];
+    TelemetryFrame frame;
+    frame.type = TELEMETRY_FRAME_CONTROL;
+    frame.version = TELEMETRY_VERSION;
+    frame.seq = _seq++;
+    frame.timeMs = sample.timeMs;
+    frame.temp = (int16_t)constrain(fixedToTenths(sample.temp), -32768, 32767);
+    frame.setpoint = scaled(sample.setpoint, 10);
+    frame.rate = scaled(sample.rate, 100);
+    frame.p = scaled(sample.p, 10);
+    frame.i = scaled(sample.i, 10);
+    frame.d = scaled(sample.d, 10);
+    frame.feedForward = scaled(sample.feedForward, 10);
+    frame.output = scaled(sample.output, 10);
+    frame.mainPWM = sample.mainPWM;
+    frame.fryPWM = sample.fryPWM;
+    frame.fanDuty = sample.fanDuty;
+    frame.phase = sample.phase;
+    for (uint8_t k = 0; k < TELEMETRY_PROBES; ++k) {
+        frame.probes[k] = ControlSample::probeTenths(sample.probes[k]);
+    }
+    frame.flags = sample.sensorFault ? TELEMETRY_FLAG_SENSOR_FAULT : 0;
+    memcpy(raw, &frame, sizeof(frame));
+    uint16_t crc = telemetryCrc16(raw, sizeof(frame));
+    raw[sizeof(frame)] = crc & 0xFF;
+    raw[sizeof(frame) + 1] = crc >> 8;
+
+    uint8_t encoded[TELEMETRY_MAX_ENCODED];
+    encoded[0] = 0;
+    size_t len = 1 + cobsEncode(raw, sizeof(raw), encoded + 1);
+    encoded[len++] = 0;
+
+    if (len > freeSpace()) {
+        _dropped++;
+        return;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        _ring[_head] = encoded[i];
+        _head = (_head + 1) % RING_SIZE;
+    }
+    service();
+}
+
+void Telemetry::service() {
+    while (_tail != _head) {
+        int room = Serial.availableForWrite();
+        if (room <= 0) return;
+        // Contiguous run up to the ring's end or the head
+        uint16_t run = (_head > _tail) ? _head - _tail : RING_SIZE - _tail;
+        if (run > room) run = room;
+        Serial.write(_ring + _tail, run);
+        _tail = (_tail + run) % RING_SIZE;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Arduino.h>
+#include "ControlSample.h"
+#include "TelemetryFrame.h"
+
+// Per-tick telemetry on the serial port, either as the human-readable log
+// line or as COBS-framed binary (see TelemetryFrame.h and
+// tools/telemetry_decode.cpp). Binary frames go into a TX ring that
+// service() drains only as far as the UART buffer has room, so sending
+// never blocks; frames that don't fit in the ring are dropped.
+class Telemetry {
+public:
+    enum Mode { TEXT, BINARY };
+    static const uint16_t RING_SIZE = 1024;
+
+    Telemetry();
+    void setMode(Mode mode) { _mode = mode; }
+    Mode mode() const { return _mode; }
+
+    // Queues one binary frame; does nothing in TEXT mode
+    void send(const ControlSample& sample);
+    // Moves queued bytes to the UART without blocking. Call often.
+    void service();
+
+    uint32_t droppedFrames() const { return _dropped; }
+
+private:
+    Mode _mode;
+    uint16_t _seq;
+    uint32_t _dropped;
+    uint8_t _ring[RING_SIZE];
+    uint16_t _head;    // Next byte written
+    uint16_t _tail;    // Next byte sent
+
+    uint16_t freeSpace() const;
+};
+
+extern Telemetry telemetry;
@@ -0,0 +1,92 @@
+#pragma once
+
+// Binary telemetry wire format, shared by the firmware and the host decoder
+// in tools/. Each frame is a TelemetryFrame followed by a CRC-16/CCITT of
+// the frame, COBS encoded with a 0 byte either side, so a text log line
+// between frames stays in its own block. Multi-byte fields are
+// little-endian. Anything between delimiters that fails to decode or check
+// is not a frame.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define TELEMETRY_FRAME_CONTROL 1
+#define TELEMETRY_VERSION 3        // 2 added the probe readings, 3 the flags
+#define TELEMETRY_PROBES 4
+#define TELEMETRY_NO_READING INT16_MIN
+#define TELEMETRY_FLAG_SENSOR_FAULT 0x01   // Every probe failed; heat cut, run stopped
+
+struct TelemetryFrame {
+    uint8_t type;          // TELEMETRY_FRAME_CONTROL
+    uint8_t version;
+    uint16_t seq;          // Increments per frame; gaps mean lost frames
+    uint32_t timeMs;       // Profile time
+    int16_t temp;          // 0.1 C
+    int16_t setpoint;      // 0.1 C
+    int16_t rate;          // 0.01 C/s
+    int16_t p, i, d;       // 0.1 %
+    int16_t feedForward;   // 0.1 %
+    int16_t output;        // 0.1 %
+    uint8_t mainPWM;       // %
+    uint8_t fryPWM;
+    uint8_t fanDuty;
+    uint8_t phase;
+    int16_t probes[TELEMETRY_PROBES];   // 0.1 C, TELEMETRY_NO_READING if none
+    uint8_t flags;         // TELEMETRY_FLAG_*
+} __attribute__((packed));
+
+// Payload plus CRC, plus COBS overhead (one byte per 254) and the delimiters
+#define TELEMETRY_MAX_ENCODED (sizeof(TelemetryFrame) + 2 + 2 + 2)
+
+inline uint16_t telemetryCrc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t b = 0; b < 8; ++b) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// COBS encodes len bytes into out (which needs len + len/254 + 1 bytes).
+// Returns the encoded length, not including the 0 delimiter.
+inline size_t cobsEncode(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t codeIdx = 0, outIdx = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < len; ++i) {
+        if (in[i] == 0) {
+            out[codeIdx] = code;
+            codeIdx = outIdx++;
+            code = 1;
+        } else {
+            out[outIdx++] = in[i];
+            if (++code == 0xFF) {
+                out[codeIdx] = code;
+                codeIdx = outIdx++;
+                code = 1;
+            }
+        }
+    }
+    out[codeIdx] = code;
+    return outIdx;
+}
+
+// Decodes a COBS block (without its delimiter). Returns the decoded length,
+// or 0 if the block is malformed or doesn't fit in outSize.
+inline size_t cobsDecode(const uint8_t* in, size_t len, uint8_t* out, size_t outSize) {
+    size_t i = 0, o = 0;
+    while (i < len) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > len) return 0;
+        for (uint8_t k = 1; k < code; ++k) {
+            if (o >= outSize) return 0;
+            out[o++] = in[i++];
+        }
+        if (code != 0xFF && i < len) {
+            if (o >= outSize) return 0;
+            out[o++] = 0;
+        }
+    }
+    return o;
+}
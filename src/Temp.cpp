@@ -1,20 +1,66 @@
 #include <Adafruit_MAX31856.h>
-#include "DWFilter.h" 
 #include <SPI.h>
 #include <PID_v2.h>
 #include "temp.h"
 #include "ArduinoMenu.h"
+#include "SensorManager.h"
+#include "FilterPipeline.h"
+#include "TempEstimator.h"
+#include "LagCompensator.h"
 
-// MAX31856 SPI pins (adjust as needed)
-#define MAX31856_CS   32
+// MAX31856 SPI pins shared by all probes (adjust as needed)
 #define MAX31856_SCK  33
 #define MAX31856_MISO 39
 #define MAX31856_MOSI 14
-#define MAX31856_DataReady 13
 
-
-DWFilter myFilter(2); 
-Adafruit_MAX31856 thermocouple(MAX31856_CS, MAX31856_MOSI, MAX31856_MISO, MAX31856_SCK);
+// One entry per fitted MAX31856: name, CS, DRDY, role, fusion weight.
+// Board probes are weighted over the air probe since they track the
+// solder joint temperature more closely.
+static const SensorManager::ProbeConfig probeConfigs[] = {
+    {"Air",   32, 13, SensorManager::AIR,   1.0f},
+    // {"Board", 16, 34, SensorManager::BOARD, 3.0f},
+};
+
+// Controller: reject single-sample spikes with minimal lag; the PID filters
+// its own derivative. Display: median then a gentle EMA for a steady readout.
+static const FilterPipeline::StageConfig controlStages[] = {
+    {FilterPipeline::MEDIAN, 3, 0},
+};
+static const FilterPipeline::StageConfig displayStages[] = {
+    {FilterPipeline::MEDIAN, 3, 0},
+    {FilterPipeline::EMA, 0.2f, 0},
+};
+
+FilterPipeline controlFilter(controlStages, sizeof(controlStages) / sizeof(controlStages[0]));
+FilterPipeline displayFilter(displayStages, sizeof(displayStages) / sizeof(displayStages[0]));
+// MAX31856 settings for each sensor mode: ramps want the freshest reading,
+// holds the quietest
+static const SensorManager::Conversion sensorConversions[] = {
+    {1, false},   // SENSOR_FAST: ~100 ms per reading
+    {4, false},   // SENSOR_QUIET: ~220 ms, half the noise
+};
+// Target rates at or below this (C/s) count as a hold
+#define SENSOR_HOLD_RATE 0.25f
+// Thermocouple noise with no averaging (C)
+#define SENSOR_NOISE 0.25f
+
+SensorMode sensorMode = SENSOR_FAST;
+
+// Temperature/rate estimator fed from the control filter. The heater input
+// model is off (powerGain 0) until the oven's gain and loss are measured.
+TempEstimator estimator({
+    SENSOR_NOISE,  // thermocouple noise C
+    0.05f,  // rate random walk C/s per sqrt(s)
+    0.0f,   // C/s per % heater
+    60.0f   // heater response time constant s
+});
+// Probe lead compensation, off until the probe's time constant is set
+LagCompensator lagCompensator({
+    0.0f,   // probe time constant s
+    0.3f,   // added noise budget C
+    15.0f   // largest lead C
+});
+SensorManager sensors(MAX31856_SCK, MAX31856_MISO, MAX31856_MOSI);
 
 // double Kp = 1.7, Ki = 0.075, Kd = 55;
 //double Kp = 1.7, Ki = 0.05, Kd = 35;
@@ -34,96 +80,64 @@ Adafruit_MAX31856 thermocouple(MAX31856_CS, MAX31856_MOSI, MAX31856_MISO, MAX318
 //double Kp = 2.5, Ki = 0.02, Kd = 75;  // Ok. Kd makes has heavy influence and is noisey
 // double Kp = 2.5, Ki = 0.02, Kd = 45; // Improved. Decrease further
 double Kp = 2.5, Ki = 0.02, Kd = 25; 
+// Filtered PID: setpoint weight, derivative filter Tf (s), anti-windup Tt (s, 0 = sqrt(Ti*Td))
+// The derivative comes from the estimator's rate, which is already smoothed,
+// so it only needs a light filter here
+double SpWeight = 1.0, DerivTf = 0.5, TrackTt = 0;
 
 PID_v2 myPID(Kp, Ki, Kd, PID::Direct);
 
-float currentReading;
+float compensatedTemp;
+FixedTemp controlFixedTemp;
+uint32_t samplesConsumed;
 float ReadTemp(bool block) {
-    bool readNow = false;
-
-    if(block) {
-        unsigned long startTime = millis();
-        if( (digitalRead(MAX31856_DataReady) != LOW) &&
-            (millis() - startTime < 500) ) {
-            delay(10);
-        } 
+    // Each new sample goes through every consumer's filter once, so a
+    // consumer's filter runs at the sensor rate however often it reads
+    if( sensors.poll(block) && !sensors.allFaulted() ) {
+        FixedTemp rawTemp = sensors.fused();
+        FixedTemp controlTemp = controlFilter.filter(rawTemp);
+        displayFilter.filter(rawTemp);
+        // The estimator and lag compensation feed the controller, so they work in float
+        float controlC = fixedToC(controlTemp);
+        estimator.update(millis(), controlC);
+        compensatedTemp = lagCompensator.apply(controlC, estimator.rate(), estimator.rateUncertainty());
+        controlFixedTemp = (compensatedTemp == controlC) ? controlTemp : toFixedTemp(compensatedTemp);
+        samplesConsumed++;
     }
 
-    if( digitalRead(MAX31856_DataReady) == LOW ) {
-        // Data is ready, read immediately
-        readNow = true;
-    }   
-
-
-    if( readNow ) {
-        float rawTemp = thermocouple.readThermocoupleTemperature();
-        currentReading = GetFilteredTemp(rawTemp);
-
-        //Serial.printf("Temp: (R:%.2fC, F:%.2fC) d:%.2fC\n", rawTemp, currentReading, rawTemp-currentReading );
-    } 
-
-    return currentReading;
+    return compensatedTemp;
 }
 
-float GetFilteredTemp(float temp) {
-    static const int tempBufferSize = 3;
-    static float tempBuffer[tempBufferSize];
-    static int8_t tempPtr = -1; // -1 designates not initialised
-    static float movingAverage=-1.0;    
+FixedTemp ControlTemp() {
+    return controlFixedTemp;
+}
 
-    // Add to buffer
-    if( tempPtr == -1 ) {
-        // First reading
-        for(uint i=0; i< tempBufferSize; i++) {
-        tempBuffer[i] = temp;
-        }
-        tempPtr++;
-    } else {
-        tempPtr++;
-        tempPtr%=tempBufferSize;
-        tempBuffer[tempPtr] = temp;
-    }
+FixedTemp DisplayTemp() {
+    return displayFilter.value();
+}
 
-    float median = Median3( tempBuffer[0], tempBuffer[1], tempBuffer[2]);
-    //float median = Median5( tempBuffer[0], tempBuffer[1], tempBuffer[2],tempBuffer[3],tempBuffer[4]);
-    median = temp;
+float TempRate() {
+    return estimator.rate();
+}
 
-    if( movingAverage < 0.0) {
-        movingAverage = median;
-    }
+bool TempValid() {
+    return !sensors.allFaulted();
+}
 
-    movingAverage = 0.2* median + (1 - 0.2) * movingAverage;
-    //return movingAverage;
-    return temp;
-}
-
-float Median3(float a, float b, float c) {
-    if ((a > b) != (a > c)) return a;
-    else if ((b > a) != (b > c)) return b;
-    else return c;
-}
-
-// Median of 5 values
-float Median5(float a, float b, float c, float d, float e) {
-    float arr[5] = {a, b, c, d, e};
-    // Simple insertion sort for 5 elements
-    for (int i = 1; i < 5; ++i) {
-        float key = arr[i];
-        int j = i - 1;
-        while (j >= 0 && arr[j] > key) {
-            arr[j + 1] = arr[j];
-            --j;
-        }
-        arr[j + 1] = key;
-    }
-    return arr[2]; // median
+uint32_t TempSampleCount() {
+    return samplesConsumed;
 }
 
 // PID output functions
 void InitPID() {
     myPID.SetOutputLimits(-100, 100);
     myPID.SetSampleTime(1000);
-    float currentReading = myFilter.filter(ReadTemp(true));
+    myPID.SetAlgorithm(PID::Algorithm::Filtered);
+    myPID.SetFilterTunings(SpWeight, DerivTf, TrackTt);
+    myPID.SetActuatorLimits(0, 100);
+    myPID.SetFeedForward(0);
+    myPID.SetDerivativeSource(PID::D_Source::External);
+    float currentReading = ReadTemp(true);
     myPID.Start(currentReading, 0, currentReading);
 }
 
@@ -131,17 +145,54 @@ void SetPIDTargetTemp(float temp) {
     myPID.Setpoint(temp);
 }
 
+void SetPIDFeedForward(float feedForward) {
+    myPID.SetFeedForward(feedForward);
+}
+
 float GetPIDOutput(float actualTemp) {  
-    float output = myPID.Run(actualTemp);
+    float output = myPID.Run(actualTemp, estimator.rate());
     return output;
 }
 
+void SetHeaterInput(float heaterPct) {
+    estimator.setInput(heaterPct);
+}
+
+void SetProbeLag(float tauSeconds) {
+    lagCompensator.setTau(tauSeconds);
+}
+
 void InitTempSensor() {
-    thermocouple.begin();
-    thermocouple.setThermocoupleType(MAX31856_TCTYPE_K); // Set to your thermocouple type if different
-    thermocouple.setNoiseFilter(MAX31856_NOISE_FILTER_50HZ); // Set noise filter to 50Hz
-    thermocouple.setConversionMode(MAX31856_CONTINUOUS); // Set to continuous
-    pinMode(MAX31856_DataReady, INPUT); // Set Data Ready pin as input with pull-up
+    for (const SensorManager::ProbeConfig& probe : probeConfigs) {
+        sensors.addProbe(probe);
+    }
+    sensors.begin();
+    sensors.setConversion(sensorConversions[sensorMode]);
+}
+
+SensorMode SensorModeFor(float targetRate) {
+    return fabs(targetRate) > SENSOR_HOLD_RATE ? SENSOR_FAST : SENSOR_QUIET;
+}
+
+void SetSensorMode(SensorMode mode) {
+    if (mode == sensorMode) return;
+    sensorMode = mode;
+    const SensorManager::Conversion& conversion = sensorConversions[mode];
+    sensors.setConversion(conversion);
+
+    // Averaging lowers the reading noise by sqrt(samples); tell the
+    // estimator so it weighs the new readings correctly
+    TempEstimator::Config config = estimator.config();
+    config.measurementNoise = SENSOR_NOISE / sqrtf(sensors.conversion().averaging);
+    estimator.setConfig(config);
+
+    Serial.printf("Sensor mode %s: %d-sample averaging, %lums per reading\n",
+                  mode == SENSOR_FAST ? "fast" : "quiet", sensors.conversion().averaging,
+                  (unsigned long)sensors.samplePeriodMs());
+}
+
+uint32_t SensorSamplePeriodMs() {
+    return sensors.samplePeriodMs();
 }
 
 
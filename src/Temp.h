@@ -1,17 +1,49 @@
 #pragma once
 #include <PID_v2.h>
+#include "SensorManager.h"
+#include "FilterPipeline.h"
+#include "TempEstimator.h"
+#include "LagCompensator.h"
+#include "FixedTemp.h"
 
+// Polls the probes and returns the controller's filtered temperature,
+// lead-compensated for the probe lag when that is enabled
 float ReadTemp(bool block = false);
-float GetFilteredTemp(float temp);
-float Median3(float a, float b, float c);
-float Median5(float a, float b, float c, float d, float e);
+// ReadTemp's result in fixed point, for recording and plotting
+FixedTemp ControlTemp();
+// Display-filtered temperature as of the last ReadTemp
+FixedTemp DisplayTemp();
+// Estimated rate of rise (C/s) as of the last ReadTemp
+float TempRate();
+// False once every probe is faulted or stale. ReadTemp then keeps returning
+// its last value, which must not be controlled on: cut the heat instead.
+bool TempValid();
+// Samples ReadTemp has consumed; the readings only change when this does
+uint32_t TempSampleCount();
 
 // New methods
 void InitPID();
 void SetPIDTargetTemp(float temp);
+void SetPIDFeedForward(float feedForward);
 float GetPIDOutput(float actualTemp);
+// Heater demand (%) applied, for the estimator's input model
+void SetHeaterInput(float heaterPct);
 
 // New method for sensor initialization
 void InitTempSensor();
+// Probe time constant for lag compensation, 0 = off
+void SetProbeLag(float tauSeconds);
 
-extern PID_v2 myPID;
\ No newline at end of file
+// Sensor conversion trade-off: FAST for ramps, QUIET (hardware averaging)
+// for holds. The sample period changes with the mode.
+enum SensorMode { SENSOR_FAST = 0, SENSOR_QUIET = 1 };
+SensorMode SensorModeFor(float targetRate);
+void SetSensorMode(SensorMode mode);
+uint32_t SensorSamplePeriodMs();
+
+extern PID_v2 myPID;
+extern SensorManager sensors;
+extern FilterPipeline controlFilter;
+extern FilterPipeline displayFilter;
+extern TempEstimator estimator;
+extern LagCompensator lagCompensator;
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "TempEstimator.h"
+#include <math.h>
+
+// Largest gap treated as one prediction step; longer gaps restart the filter
+#define MAX_STEP_MS 5000
+
+TempEstimator::TempEstimator(const Config& config)
+    : cfg(config)
+{
+    reset();
+}
+
+void TempEstimator::setConfig(const Config& newConfig) {
+    cfg = newConfig;
+}
+
+void TempEstimator::reset() {
+    initialised = false;
+    lastMs = 0;
+    input = 0;
+    temp = 0;
+    rateCPerS = 0;
+    p00 = p01 = p11 = 0;
+}
+
+void TempEstimator::update(uint32_t nowMs, float measuredTemp) {
+    float r = cfg.measurementNoise * cfg.measurementNoise;
+    uint32_t stepMs = nowMs - lastMs;
+    if (!initialised || stepMs > MAX_STEP_MS) {
+        initialised = true;
+        lastMs = nowMs;
+        temp = measuredTemp;
+        rateCPerS = 0;
+        p00 = r;
+        p01 = 0;
+        p11 = 1.0f;   // Start unsure of the rate (+-1 C/s)
+        return;
+    }
+    if (stepMs == 0) return;
+    float dt = stepMs / 1000.0f;
+    lastMs = nowMs;
+
+    // Predict. Rate decays towards the heater-driven rate when modelled:
+    // R' = a*R + (1-a)*K*u, T' = T + R*dt
+    float a = 1.0f;
+    if (cfg.powerGain > 0 && cfg.powerTau > 0) {
+        a = expf(-dt / cfg.powerTau);
+    }
+    temp += rateCPerS * dt;
+    rateCPerS = a * rateCPerS + (1.0f - a) * cfg.powerGain * input;
+
+    // P' = F P F' + Q with F = [[1, dt], [0, a]] and Q from a white rate
+    // disturbance of spectral density q
+    float q = cfg.rateNoise * cfg.rateNoise;
+    float n00 = p00 + 2 * dt * p01 + dt * dt * p11 + q * dt * dt * dt / 3;
+    float n01 = a * (p01 + dt * p11) + q * dt * dt / 2;
+    float n11 = a * a * p11 + q * dt;
+
+    // Correct with the measured temperature (H = [1, 0])
+    float s = n00 + r;
+    float k0 = n00 / s;
+    float k1 = n01 / s;
+    float innovation = measuredTemp - temp;
+    temp += k0 * innovation;
+    rateCPerS += k1 * innovation;
+
+    p00 = (1 - k0) * n00;
+    p01 = (1 - k0) * n01;
+    p11 = n11 - k1 * n01;
+}
+
+float TempEstimator::temperatureAt(uint32_t nowMs) const {
+    return temp + rateCPerS * ((int32_t)(nowMs - lastMs) / 1000.0f);
+}
+
+float TempEstimator::rateUncertainty() const {
+    return sqrtf(p11 > 0 ? p11 : 0);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+
+// Two-state Kalman filter tracking oven temperature and rate of rise from
+// the thermocouple samples. The model is constant rate, optionally pulled
+// towards powerGain * heater% with time constant powerTau so the rate
+// estimate responds as soon as the heaters change rather than when the
+// thermocouple notices.
+//
+// It runs once per sensor sample. On a steady ramp the estimates have no
+// lag relative to the last sample; temperatureAt() extrapolates from that
+// sample's time so consumers can account for its age.
+class TempEstimator {
+public:
+    struct Config {
+        float measurementNoise;   // Thermocouple noise std dev (C)
+        float rateNoise;          // Rate random walk (C/s per sqrt(s))
+        float powerGain;          // Steady-state C/s per % heater, 0 = no input model
+        float powerTau;           // Rate response time constant to heater changes (s)
+    };
+
+    TempEstimator(const Config& config);
+    void setConfig(const Config& config);
+    const Config& config() const { return cfg; }
+    void reset();
+
+    // Heater demand (0-100 %) applied from now on
+    void setInput(float heaterPct) { input = heaterPct; }
+    // One thermocouple sample taken at nowMs
+    void update(uint32_t nowMs, float measuredTemp);
+
+    bool valid() const { return initialised; }
+    float temperature() const { return temp; }
+    float rate() const { return rateCPerS; }
+    // Temperature extrapolated from the last sample to nowMs
+    float temperatureAt(uint32_t nowMs) const;
+    uint32_t sampleTimeMs() const { return lastMs; }
+    // Std dev of the rate estimate (C/s)
+    float rateUncertainty() const;
+
+private:
+    Config cfg;
+    bool initialised;
+    uint32_t lastMs;
+    float input;
+    float temp;
+    float rateCPerS;
+    // Error covariance [[p00, p01], [p01, p11]]
+    float p00, p01, p11;
+};
@@ -1,1289 +1,578 @@
-// Logo data
+// Generated by tools/assets.py from Logo/logo_rgb565.h, do not edit
 #pragma once
 
 #include <pgmspace.h>
 
-const unsigned short logo[20480] PROGMEM={
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1000 (16) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2000 (32) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3000 (48) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4000 (64) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5000 (80) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6000 (96) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7000 (112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8000 (128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9000 (144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA000 (160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB000 (176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC000 (192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD000 (208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE000 (224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF000 (240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0001 (256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1001 (272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2001 (288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3001 (304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4001 (320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5001 (336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6001 (352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7001 (368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8001 (384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9001 (400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA001 (416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB001 (432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC001 (448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD001 (464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE001 (480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF001 (496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0002 (512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1002 (528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2002 (544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3002 (560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4002 (576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5002 (592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6002 (608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7002 (624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8002 (640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9002 (656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA002 (672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB002 (688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC002 (704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD002 (720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE002 (736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF002 (752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0003 (768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1003 (784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2003 (800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3003 (816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4003 (832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5003 (848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6003 (864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7003 (880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8003 (896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9003 (912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA003 (928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB003 (944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC003 (960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD003 (976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE003 (992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF003 (1008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0004 (1024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1004 (1040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2004 (1056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3004 (1072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4004 (1088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5004 (1104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6004 (1120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7004 (1136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8004 (1152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9004 (1168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA004 (1184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0008, 0x0008,   // 0xB004 (1200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC004 (1216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD004 (1232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE004 (1248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF004 (1264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0005 (1280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1005 (1296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2005 (1312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3005 (1328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4005 (1344) pixels
-0x0000, 0x0000, 0x2842, 0xAF73, 0xA631, 0xE2BA, 0x24F4, 0x24F4, 0xE3EB, 0xE3EB, 0xE3EB, 0xE3EB, 0xE4EB, 0x04EC, 0x04EC, 0x04EC,   // 0x5005 (1360) pixels
-0x04EC, 0x03EC, 0x03EC, 0x03EC, 0x04EC, 0x24F4, 0xE2F3, 0x41AA, 0x4842, 0x6E6B, 0xA631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6005 (1376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7005 (1392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8005 (1408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9005 (1424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA005 (1440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB005 (1456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC005 (1472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD005 (1488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE005 (1504) pixels
-0x0000, 0x5184, 0x9ACE, 0x59C6, 0x4D6B, 0x22CB, 0xE2FB, 0xE2FB, 0xC2FB, 0xC2FB, 0xC2FB, 0xC2FB, 0xC2FB, 0xC2FB, 0xC2FB, 0xC2FB,   // 0xF005 (1520) pixels
-0xC2FB, 0xE2FB, 0xE2FB, 0xC2FB, 0xC2FB, 0xE2FB, 0x81F3, 0x80C2, 0x5184, 0x38BE, 0x18B6, 0x2C63, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0006 (1536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1006 (1552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2006 (1568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3006 (1584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4006 (1600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5006 (1616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6006 (1632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7006 (1648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8006 (1664) pixels
-0x694A, 0xBBD6, 0x18BE, 0xB294, 0x494A, 0x80B2, 0x40F3, 0x60F3, 0x60F3, 0x20E3, 0x00DB, 0xC0D2, 0xE0DA, 0x00E3, 0x00EB, 0x00E3,   // 0x9006 (1680) pixels
-0xE0DA, 0xE1D2, 0x21E3, 0x40EB, 0x61F3, 0x40F3, 0x00EB, 0x40B2, 0xEC5A, 0xF394, 0x39C6, 0xB7AD, 0x6529, 0x0000, 0x0000, 0x0000,   // 0xA006 (1696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB006 (1712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC006 (1728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD006 (1744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE006 (1760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF006 (1776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0007 (1792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1007 (1808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2007 (1824) pixels
-0x34A5, 0x9ACE, 0xF394, 0x0000, 0x0000, 0x0000, 0x6030, 0x4028, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x2018, 0x0000,   // 0x3007 (1840) pixels
-0x0000, 0x0000, 0x0000, 0x0010, 0x4028, 0x6030, 0x0008, 0x0000, 0x0000, 0x0000, 0xD7B5, 0xF7B5, 0x2C63, 0x0000, 0x0000, 0x0000,   // 0x4007 (1856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5007 (1872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6007 (1888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7007 (1904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8007 (1920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9007 (1936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA007 (1952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB007 (1968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC007 (1984) pixels
-0x75AD, 0x59C6, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD007 (2000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB7B5, 0x18BE, 0x4D63, 0x0000, 0x0000, 0x0000,   // 0xE007 (2016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF007 (2032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0008 (2048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1008 (2064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2008 (2080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3008 (2096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4008 (2112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5008 (2128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6008 (2144) pixels
-0x55AD, 0x59C6, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7008 (2160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6B5, 0x18BE, 0x4D63, 0x0000, 0x0000, 0x0000,   // 0x8008 (2176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9008 (2192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA008 (2208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB008 (2224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC008 (2240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD008 (2256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE008 (2272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF008 (2288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0009 (2304) pixels
-0x34A5, 0x59C6, 0x928C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1009 (2320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96AD, 0xD7B5, 0x2C63, 0x0000, 0x0000, 0x0000,   // 0x2009 (2336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3009 (2352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4009 (2368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5009 (2384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6009 (2400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7009 (2416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8009 (2432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9009 (2448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA009 (2464) pixels
-0x149D, 0x18BE, 0x728C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB009 (2480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96AD, 0xD7B5, 0x0C63, 0x0000, 0x0000, 0x0000,   // 0xC009 (2496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD009 (2512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE009 (2528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF009 (2544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x000A (2560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x100A (2576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x200A (2592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x300A (2608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x400A (2624) pixels
-0x694A, 0x4D63, 0x4942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x500A (2640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB52, 0xEB5A, 0x4521, 0x0000, 0x0000, 0x0000,   // 0x600A (2656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x700A (2672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x800A (2688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x900A (2704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA00A (2720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB00A (2736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC00A (2752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD00A (2768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE00A (2784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF00A (2800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x000B (2816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x100B (2832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x200B (2848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x300B (2864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x400B (2880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x500B (2896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x600B (2912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x700B (2928) pixels
-0xA631, 0x14A5, 0xBAD6, 0x3CE7, 0x5DEF, 0x5DE7, 0x3CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7,   // 0x800B (2944) pixels
-0x1CDF, 0x1CDF, 0x1CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CDF,   // 0x900B (2960) pixels
-0x1BDF, 0x1BDF, 0x1BDF, 0x1BDF, 0x1CE7, 0x1CE7, 0x1CE7, 0x3CE7, 0x3CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7,   // 0xA00B (2976) pixels
-0x1CE7, 0x1CDF, 0x1CDF, 0x1BDF, 0xFBDE, 0xFBDE, 0xFBDE, 0xFBDE, 0xFBDE, 0xDBDE, 0xF7BD, 0xEF7B, 0xA210, 0x0000, 0x0000, 0x0000,   // 0xB00B (2992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC00B (3008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD00B (3024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE00B (3040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF00B (3056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x000C (3072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD39C,   // 0x100C (3088) pixels
-0x7DEF, 0xDEF7, 0x9DEF, 0x5DE7, 0x3CE7, 0x3CE7, 0x3DE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3DE7, 0x5DE7, 0x5DEF, 0x5DEF, 0x5DE7, 0x5DE7,   // 0x200C (3104) pixels
-0x5DE7, 0x3CE7, 0x5CE7, 0x5DE7, 0x5DEF, 0x5DEF, 0x5DEF, 0x5DEF, 0x5DEF, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DEF, 0x5DEF,   // 0x300C (3120) pixels
-0x5DEF, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DEF, 0x5DEF, 0x5DE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3DE7, 0x5DE7, 0x5DE7,   // 0x400C (3136) pixels
-0x5CE7, 0x3CE7, 0x3CE7, 0x1CE7, 0x1CDF, 0xFCDE, 0xFBDE, 0xDBD6, 0xBBD6, 0xBBD6, 0xDBD6, 0xDBD6, 0x38C6, 0x4D63, 0x0000, 0x0000,   // 0x500C (3152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x600C (3168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x700C (3184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x800C (3200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x900C (3216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA00C (3232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7BD, 0xFFFF,   // 0xB00C (3248) pixels
-0x5DEF, 0x9ACE, 0x38BE, 0xB6B5, 0x75AD, 0x75AD, 0x75AD, 0x75AD, 0x55AD, 0x55A5, 0x55A5, 0x55A5, 0x55A5, 0x55A5, 0x55A5, 0x55A5,   // 0xC00C (3264) pixels
-0x55A5, 0x55A5, 0x55A5, 0x55A5, 0x55A5, 0x75AD, 0x76AD, 0x96AD, 0x96AD, 0x76AD, 0x75AD, 0x75AD, 0x75AD, 0x75AD, 0x75AD, 0x76AD,   // 0xD00C (3280) pixels
-0x95AD, 0x76AD, 0x76AD, 0x96AD, 0x96AD, 0x96AD, 0x96AD, 0x75AD, 0x55AD, 0x55AD, 0x55AD, 0x75AD, 0x76AD, 0x96AD, 0x96AD, 0x96AD,   // 0xE00C (3296) pixels
-0x96AD, 0x96AD, 0x96AD, 0x96AD, 0x96AD, 0xB6AD, 0xB6AD, 0xB6AD, 0xB6AD, 0xF8BD, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x3084, 0x0000,   // 0xF00C (3312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x000D (3328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x100D (3344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x200D (3360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x300D (3376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x400D (3392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x14A5, 0xFFFF, 0x3CE7,   // 0x500D (3408) pixels
-0x7AC6, 0xD394, 0x6D6B, 0x34A5, 0xB6B5, 0xD7BD, 0xF7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5,   // 0x600D (3424) pixels
-0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x95AD, 0x75AD, 0x55AD, 0x55A5,   // 0x700D (3440) pixels
-0x55A5, 0x55AD, 0x75AD, 0x75AD, 0x96B5, 0x96B5, 0x96B5, 0x75AD, 0x75AD, 0x55AD, 0x75AD, 0x75AD, 0x96B5, 0x96B5, 0x96B5, 0x96B5,   // 0x800D (3456) pixels
-0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x95B5, 0x75AD, 0xD394, 0x6D6B, 0x35A5, 0x9ACE, 0x9ACE, 0xBACE, 0x6D6B,   // 0x900D (3472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA00D (3488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB00D (3504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC00D (3520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD00D (3536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE00D (3552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x694A, 0xBEF7, 0x5DE7, 0xBACE,   // 0xF00D (3568) pixels
-0x718C, 0xB6B5, 0xDEF7, 0xDEFF, 0xDEFF, 0xDEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EF7,   // 0x000E (3584) pixels
-0x9EF7, 0xBEF7, 0xBEF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x9EEF,   // 0x100E (3600) pixels
-0x9EF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x5DE7, 0x5DE7, 0x3CE7, 0x3CE7,   // 0x200E (3616) pixels
-0x1CDF, 0xFBD6, 0xFBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xBBD6, 0xBACE, 0x9ACE, 0x9ACE, 0xB294, 0xD394, 0xBACE, 0x9ACE, 0x39C6,   // 0x300E (3632) pixels
-0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x400E (3648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x500E (3664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x600E (3680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x700E (3696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x800E (3712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17BE, 0xBEF7, 0x9AC6, 0x96AD,   // 0x900E (3728) pixels
-0x34A5, 0xFFFF, 0xBEF7, 0xFBD6, 0x9ACE, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xA00E (3744) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xB00E (3760) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xC00E (3776) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0xCF73, 0xD7B5, 0x9ACE, 0x9ACE,   // 0xD00E (3792) pixels
-0xEF7B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE00E (3808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF00E (3824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x000F (3840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x100F (3856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x200F (3872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x9EF7, 0x5DE7, 0x9ACE, 0x8E6B,   // 0x300F (3888) pixels
-0x7DEF, 0x9EEF, 0x9ACE, 0x7AC6, 0xBACE, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x400F (3904) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x500F (3920) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0xBACE, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x600F (3936) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xB6AD, 0xAA52, 0x59C6, 0x9ACE,   // 0x700F (3952) pixels
-0x76AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x800F (3968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x900F (3984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA00F (4000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB00F (4016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC00F (4032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x694A, 0xFFFF, 0xFBD6, 0x9ACE, 0x107C,   // 0xD00F (4048) pixels
-0xBEF7, 0xBBD6, 0x7AC6, 0x5DE7, 0xDFFF, 0xDEF7, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xE00F (4064) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x38BE, 0x4D63, 0x8629, 0x6529, 0x6529, 0x6529, 0x6629, 0x8629, 0x8629, 0x8629, 0x8629, 0x8629, 0x8629,   // 0xF00F (4080) pixels
-0x8629, 0x8629, 0x8631, 0x8629, 0x8631, 0x8631, 0xA631, 0xE739, 0x107C, 0x59C6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x0010 (4096) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xD7B5, 0x0421, 0x3084, 0x9ACE,   // 0x1010 (4112) pixels
-0x38C6, 0x4100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2010 (4128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3010 (4144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4010 (4160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5010 (4176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6010 (4192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB5A, 0xFFFF, 0xBBD6, 0x9ACE, 0x518C,   // 0x7010 (4208) pixels
-0xBEF7, 0x7AC6, 0xFBD6, 0xFFFF, 0xDEF7, 0xFBD6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x8010 (4224) pixels
-0x9ACE, 0x9ACE, 0x9AC6, 0x694A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9010 (4240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C63, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xA010 (4256) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x96AD, 0x2421, 0x0842, 0x9ACE,   // 0xB010 (4272) pixels
-0x7AC6, 0xA210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC010 (4288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD010 (4304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE010 (4320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF010 (4336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0011 (4352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCA52, 0xDFFF, 0xBACE, 0x9ACE, 0x718C,   // 0x1011 (4368) pixels
-0xDFF7, 0x9ACE, 0x7DEF, 0xDEF7, 0xBBD6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x2011 (4384) pixels
-0x9ACE, 0x9ACE, 0x18BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3011 (4400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8208, 0x59C6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x4011 (4416) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x76AD, 0x2421, 0xA631, 0x59C6,   // 0x5011 (4432) pixels
-0x7ACE, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6011 (4448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7011 (4464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8011 (4480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9011 (4496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA011 (4512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA52, 0xDFFF, 0x9ACE, 0x9ACE, 0x718C,   // 0xB011 (4528) pixels
-0xBFF7, 0xBACE, 0x7DEF, 0x3CE7, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xC011 (4544) pixels
-0x9ACE, 0x9ACE, 0x79C6, 0xE418, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD011 (4560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA631, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xE011 (4576) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x76AD, 0x0421, 0x8631, 0x39C6,   // 0xF011 (4592) pixels
-0x7ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0012 (4608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1012 (4624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2012 (4640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3012 (4656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4012 (4672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA52, 0xDFFF, 0x9ACE, 0x9ACE, 0x718C,   // 0x5012 (4688) pixels
-0xBEF7, 0xBACE, 0xBBD6, 0xBACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x9AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x6012 (4704) pixels
-0x9ACE, 0x9ACE, 0x7AC6, 0xD394, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7012 (4720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x55A5, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x8012 (4736) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x76A5, 0x0421, 0x6529, 0x38C6,   // 0x9012 (4752) pixels
-0x7ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA012 (4768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB012 (4784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC012 (4800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD012 (4816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE012 (4832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A52, 0xDFFF, 0x9ACE, 0x7AC6, 0x518C,   // 0xF012 (4848) pixels
-0x9EF7, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x0013 (4864) pixels
-0x7ACE, 0x7AC6, 0x7AC6, 0x7AC6, 0xD7B5, 0x35A5, 0x35A5, 0x34A5, 0x349D, 0x349D, 0x149D, 0x149D, 0x149D, 0x149D, 0x149D, 0x149D,   // 0x1013 (4880) pixels
-0x149D, 0x149D, 0x149D, 0x149D, 0x149D, 0x149D, 0x149D, 0x149D, 0x18B6, 0x7AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x2013 (4896) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x55A5, 0xE318, 0x6529, 0x38C6,   // 0x3013 (4912) pixels
-0x7ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4013 (4928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5013 (4944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6013 (4960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7013 (4976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8013 (4992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A4A, 0xDFFF, 0x9ACE, 0x7AC6, 0x5184,   // 0x9013 (5008) pixels
-0x7DEF, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x9AC6, 0x9AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xA013 (5024) pixels
-0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7AC6, 0x7AC6, 0x7AC6, 0x7ACE,   // 0xB013 (5040) pixels
-0x9ACE, 0x7ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x7AC6, 0x7AC6, 0x7AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xC013 (5056) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x35A5, 0xE318, 0x6529, 0x38C6,   // 0xD013 (5072) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE013 (5088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF013 (5104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0014 (5120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1014 (5136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2014 (5152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A4A, 0xDFFF, 0x9ACE, 0x7AC6, 0x3184,   // 0x3014 (5168) pixels
-0x5DE7, 0x9ACE, 0xBACE, 0x79C6, 0x349D, 0xB294, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C,   // 0x4014 (5184) pixels
-0x928C, 0x728C, 0x728C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x728C, 0x928C, 0x928C, 0x928C,   // 0x5014 (5200) pixels
-0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x728C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C,   // 0x6014 (5216) pixels
-0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0x928C, 0xB394, 0xB6AD, 0x9AC6, 0x7AC6, 0x7AC6, 0x359D, 0xE318, 0x6529, 0x39C6,   // 0x7014 (5232) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8014 (5248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9014 (5264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA014 (5280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB014 (5296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC014 (5312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x694A, 0xFFFF, 0xBACE, 0x7AC6, 0x3184,   // 0xD014 (5328) pixels
-0x5DE7, 0x9ACE, 0xD7B5, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE014 (5344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF014 (5360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0015 (5376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D6B, 0x59C6, 0x7AC6, 0x149D, 0xE318, 0x8631, 0x59C6,   // 0x1015 (5392) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2015 (5408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3015 (5424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4015 (5440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5015 (5456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6015 (5472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x694A, 0xFFFF, 0xBACE, 0x7AC6, 0x3184,   // 0x7015 (5488) pixels
-0x5DE7, 0x7AC6, 0x694A, 0x0000, 0x8E73, 0xB6B5, 0xD7BD, 0xD7BD, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xD7BD,   // 0x8015 (5504) pixels
-0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5, 0xB6B5,   // 0x9015 (5520) pixels
-0x96B5, 0x96B5, 0x96B5, 0x96B5, 0x96AD, 0x75AD, 0x75AD, 0x75AD, 0x75AD, 0x55AD, 0x34A5, 0x14A5, 0xF39C, 0xD394, 0x9294, 0x718C,   // 0xA015 (5536) pixels
-0x518C, 0x3084, 0x1084, 0xCF7B, 0x8E73, 0x4D6B, 0x0C5B, 0x4942, 0x4108, 0x0000, 0xB28C, 0x7AC6, 0x149D, 0x0419, 0xA631, 0x59C6,   // 0xB015 (5552) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC015 (5568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD015 (5584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE015 (5600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF015 (5616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0016 (5632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x494A, 0xFFFF, 0xBACE, 0x7ACE, 0x3084,   // 0x1016 (5648) pixels
-0x5DE7, 0xD7B5, 0x0000, 0xE739, 0x1BE7, 0x59CE, 0x38C6, 0x18C6, 0x18C6, 0x18C6, 0x18BE, 0xF8BD, 0xF7BD, 0xF7BD, 0xF7BD, 0xD7BD,   // 0x2016 (5664) pixels
-0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xD7BD, 0xD7B5, 0xD7B5, 0xB6B5, 0xB6B5, 0xB6B5, 0x96B5, 0x96B5, 0x96AD, 0x76AD, 0x75AD, 0x75AD,   // 0x3016 (5680) pixels
-0x55AD, 0x55AD, 0x55A5, 0x34A5, 0x149D, 0xF39C, 0xD39C, 0xB294, 0x9294, 0x718C, 0x5184, 0x3084, 0x107C, 0xF07B, 0xEF7B, 0xEF7B,   // 0x4016 (5696) pixels
-0xEF7B, 0xEF7B, 0x107C, 0x107C, 0x107C, 0x107C, 0xEF7B, 0xEF7B, 0xAA52, 0x0000, 0x694A, 0x9ACE, 0x34A5, 0x0421, 0xA631, 0x59C6,   // 0x5016 (5712) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6016 (5728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7016 (5744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8016 (5760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9016 (5776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA016 (5792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x494A, 0xFFFF, 0xBACE, 0x9ACE, 0x5184,   // 0xB016 (5808) pixels
-0x5DE7, 0x96AD, 0x0000, 0x2C63, 0x718C, 0x307C, 0x3084, 0x3184, 0x3084, 0x3084, 0x1084, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C,   // 0xC016 (5824) pixels
-0x307C, 0x107C, 0x3084, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C,   // 0xD016 (5840) pixels
-0x107C, 0x107C, 0xF07B, 0xF07B, 0xF07B, 0xF07B, 0xF07B, 0xF07B, 0xF07B, 0xF07B, 0x107C, 0x107C, 0xF07B, 0xF07B, 0xF07B, 0xF07B,   // 0xE016 (5856) pixels
-0x107C, 0x1084, 0x3084, 0x3084, 0x3084, 0x3084, 0x107C, 0x107C, 0x6D6B, 0x0000, 0xA631, 0x9ACE, 0x35A5, 0x2421, 0xA631, 0x59C6,   // 0xF016 (5872) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0017 (5888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1017 (5904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2017 (5920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3017 (5936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4017 (5952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4942, 0xDFFF, 0x9ACE, 0x9ACE, 0x5184,   // 0x5017 (5968) pixels
-0x3DE7, 0x75AD, 0x0000, 0xA631, 0xCB52, 0xAB52, 0xCB52, 0xCB5A, 0xCB5A, 0xCB5A, 0xCB52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52,   // 0x6017 (5984) pixels
-0xCB52, 0xCB52, 0xCB52, 0xCB52, 0xAA52, 0xAA52, 0xAB52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52,   // 0x7017 (6000) pixels
-0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAA52, 0xAB52, 0xAB52, 0xCB52, 0xCB52, 0xAB52, 0xAA52, 0xAA52, 0xAA52,   // 0x8017 (6016) pixels
-0xCB52, 0xCB5A, 0xCB5A, 0xCB5A, 0xCB5A, 0xCB52, 0xAB52, 0xCB52, 0x494A, 0x0000, 0x8629, 0x9ACE, 0x34A5, 0x2421, 0xA631, 0x59C6,   // 0x9017 (6032) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA017 (6048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB017 (6064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC017 (6080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD017 (6096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE017 (6112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2842, 0xFFFF, 0xBACE, 0x9ACE, 0x518C,   // 0xF017 (6128) pixels
-0x5DE7, 0x75AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0018 (6144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1018 (6160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2018 (6176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x9ACE, 0x34A5, 0x2421, 0xA631, 0x59C6,   // 0x3018 (6192) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4018 (6208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5018 (6224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6018 (6240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7018 (6256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8018 (6272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2842, 0xDFFF, 0x9ACE, 0x9ACE, 0x518C,   // 0x9018 (6288) pixels
-0x5DE7, 0x76AD, 0x0000, 0xA048, 0xA199, 0xA199, 0xA199, 0x8040, 0x0000, 0xC058, 0xC199, 0xC199, 0xC199, 0xC199, 0xC199, 0xC199,   // 0xA018 (6304) pixels
-0xC199, 0xC199, 0xC199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xC199, 0xA199, 0xA199,   // 0xB018 (6320) pixels
-0xC199, 0xC199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xA199, 0xC199, 0xC199, 0xC199, 0xC199, 0xC199,   // 0xC018 (6336) pixels
-0xC199, 0xA199, 0x8191, 0x0008, 0x0000, 0x0069, 0x8191, 0x8191, 0x6181, 0x0000, 0x6529, 0x7ACE, 0x14A5, 0x0421, 0x8631, 0x38C6,   // 0xD018 (6352) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE018 (6368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF018 (6384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0019 (6400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1019 (6416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2019 (6432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0xDFFF, 0x9ACE, 0x9ACE, 0x518C,   // 0x3019 (6448) pixels
-0x5DE7, 0x96AD, 0x0000, 0x2079, 0xC2E2, 0xC2E2, 0x82D2, 0x0010, 0x0000, 0x62C2, 0xE3EA, 0xC2EA, 0xE2EA, 0xC3EA, 0xE3EA, 0xC3EA,   // 0x4019 (6464) pixels
-0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA,   // 0x5019 (6480) pixels
-0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xC3EA, 0xE3EA, 0xE3EA, 0xE3EA,   // 0x6019 (6496) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0x4081, 0x0000, 0x0069, 0xA2E2, 0xC2E2, 0x82D2, 0x0000, 0x8629, 0x7ACE, 0x149D, 0x0419, 0x8631, 0x39C6,   // 0x7019 (6512) pixels
-0x9ACE, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8019 (6528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9019 (6544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA019 (6560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB019 (6576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC019 (6592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0xDFFF, 0x9ACE, 0x9ACE, 0x718C,   // 0xD019 (6608) pixels
-0x5DEF, 0x96AD, 0x0000, 0x4079, 0xE3EA, 0xC2EA, 0x8091, 0x0000, 0xC058, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xE2EA, 0xC3EA, 0xC3EA,   // 0xE019 (6624) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA,   // 0xF019 (6640) pixels
-0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xE3EA, 0xC3EA, 0xE3EA,   // 0x001A (6656) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0x42CA, 0x0000, 0x0000, 0x41C2, 0xE2E2, 0xA2D2, 0x0000, 0x6529, 0x9ACE, 0xF49C, 0xE318, 0x8631, 0x38C6,   // 0x101A (6672) pixels
-0x9ACE, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x201A (6688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x301A (6704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x401A (6720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x501A (6736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x601A (6752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0xDFFF, 0x9ACE, 0x7AC6, 0x718C,   // 0x701A (6768) pixels
-0x5DE7, 0x96AD, 0x0000, 0x4179, 0x03EB, 0xC2E2, 0x4028, 0x0000, 0x01B2, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xC2EA, 0xC2EA,   // 0x801A (6784) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC2EA,   // 0x901A (6800) pixels
-0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xC3EA, 0xC3EA,   // 0xA01A (6816) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xA2EA, 0x2071, 0x0000, 0x2071, 0xE3EA, 0xA2D2, 0x0000, 0x6629, 0x9ACE, 0xF39C, 0xE318, 0x8631, 0x39C6,   // 0xB01A (6832) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC01A (6848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD01A (6864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE01A (6880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF01A (6896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x001B (6912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0xDFFF, 0x9ACE, 0x7AC6, 0x5184,   // 0x101B (6928) pixels
-0x5DE7, 0x96AD, 0x0000, 0xE060, 0x62BA, 0x8189, 0x0000, 0x6040, 0xA2E2, 0xC2EA, 0xA2EA, 0x82DA, 0x01B2, 0x21B2, 0x01B2, 0x01B2,   // 0x201B (6944) pixels
-0x01AA, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x21B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2,   // 0x301B (6960) pixels
-0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x21B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2,   // 0x401B (6976) pixels
-0x01BA, 0xA2E2, 0xA2EA, 0xA2EA, 0x41CA, 0x0000, 0x0008, 0x02AA, 0x22AA, 0x0000, 0x6529, 0x7ACE, 0xD394, 0xE318, 0x8631, 0x39C6,   // 0x501B (6992) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x601B (7008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x701B (7024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x801B (7040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x901B (7056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA01B (7072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x083A, 0xDFFF, 0x9ACE, 0x9ACE, 0x5184,   // 0xB01B (7088) pixels
-0x3DE7, 0x76AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1B1, 0xC2EA, 0xC2EA, 0xC2EA, 0x4081, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC01B (7104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD01B (7120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE01B (7136) pixels
-0x0000, 0xE1B1, 0xC2EA, 0xC2EA, 0xC2EA, 0x2079, 0x0000, 0x0000, 0x0000, 0x0000, 0x6521, 0x59C6, 0xD394, 0xE318, 0x8631, 0x39C6,   // 0xF01B (7152) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x001C (7168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x101C (7184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x201C (7200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x301C (7216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x401C (7232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x083A, 0xDFFF, 0x9ACE, 0x9ACE, 0x5184,   // 0x501C (7248) pixels
-0x1CDF, 0x55A5, 0x0000, 0x6038, 0x6179, 0x6181, 0x01AA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0x62CA, 0x8181, 0x8181, 0x6181, 0x6181,   // 0x601C (7264) pixels
-0x6181, 0x6181, 0x6181, 0x8181, 0x8181, 0x8189, 0x8189, 0x8181, 0x8181, 0x8181, 0x8181, 0x8181, 0x8181, 0x8181, 0x6181, 0x6181,   // 0x701C (7280) pixels
-0x8181, 0x6181, 0x8181, 0x8181, 0x8181, 0x8181, 0x8181, 0x8181, 0x8181, 0x8181, 0x6181, 0x6179, 0x6179, 0x6179, 0x6179, 0x6181,   // 0x801C (7296) pixels
-0x8189, 0xA2DA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3E2, 0xE199, 0x6181, 0x2169, 0x0000, 0x6521, 0x59C6, 0xB394, 0xE318, 0xA631, 0x39C6,   // 0x901C (7312) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA01C (7328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB01C (7344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC01C (7360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD01C (7376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE01C (7392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE739, 0xDFFF, 0x9ACE, 0x9ACE, 0x3184,   // 0xF01C (7408) pixels
-0xFCDE, 0x55A5, 0x0000, 0x4079, 0xE3EA, 0xE3F2, 0xE3EA, 0xE3EA, 0xE3EA, 0xC2EA, 0xE2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0x001D (7424) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0x101D (7440) pixels
-0xC2EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xC3EA, 0xE3EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0x201D (7456) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xE3EA, 0xE3EA, 0xC2EA, 0x62D2, 0x0000, 0x6529, 0x59C6, 0xB294, 0xE318, 0xA631, 0x39C6,   // 0x301D (7472) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x401D (7488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x501D (7504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x601D (7520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x701D (7536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x801D (7552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE739, 0xDFFF, 0x9ACE, 0x9ACE, 0x3184,   // 0x901D (7568) pixels
-0xFCD6, 0x55A5, 0x0000, 0x4079, 0xC2EA, 0xE2EA, 0xE2EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0xA01D (7584) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0xB01D (7600) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0xC01D (7616) pixels
-0xC2EA, 0xC2EA, 0xE2EA, 0xE2EA, 0xE2EA, 0xE2EA, 0xC2EA, 0xC2EA, 0x82D2, 0x0000, 0x6529, 0x59C6, 0x9294, 0xE318, 0xA631, 0x39C6,   // 0xD01D (7632) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE01D (7648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF01D (7664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x001E (7680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x101E (7696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x201E (7712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE739, 0xDFFF, 0x9ACE, 0x9ACE, 0x3184,   // 0x301E (7728) pixels
-0xFCD6, 0x55A5, 0x0000, 0x4079, 0xC2EA, 0xE2EA, 0xE3EA, 0xE3EA, 0xE2EA, 0xE2EA, 0xC2EA, 0xC2EA, 0xA2EA, 0xA2EA, 0xA2EA, 0xC2EA,   // 0x401E (7744) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0x501E (7760) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0x601E (7776) pixels
-0xC2EA, 0xC2EA, 0xE2EA, 0xE2EA, 0xE2EA, 0xE2EA, 0xC2EA, 0xE2EA, 0x82D2, 0x0000, 0x6529, 0x39C6, 0x928C, 0xE318, 0xA631, 0x39C6,   // 0x701E (7792) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x801E (7808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x901E (7824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA01E (7840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB01E (7856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC01E (7872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE739, 0xDFFF, 0x9ACE, 0x9ACE, 0x3184,   // 0xD01E (7888) pixels
-0xDCD6, 0x55A5, 0x0000, 0xE058, 0x41BA, 0x22BA, 0xA2D2, 0xE3EA, 0xE2EA, 0xC2EA, 0x42CA, 0x01AA, 0xE1A9, 0xE1A9, 0xE1A9, 0xE1A9,   // 0xE01E (7904) pixels
-0x01AA, 0x01AA, 0x01AA, 0xE1A9, 0xE1A9, 0xE1A9, 0xE1A9, 0xE1A9, 0x41CA, 0xA2EA, 0xA2EA, 0xC2EA, 0xC3EA, 0xE3EA, 0xE3EA, 0xE3EA,   // 0xF01E (7920) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xA2E2, 0x01B2, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0xE1A9, 0xE1A9, 0xE1A9, 0xE1A9, 0xE1A9,   // 0x001F (7936) pixels
-0xE1A9, 0x01B2, 0xC2E2, 0xE2EA, 0xE3EA, 0xE2EA, 0x21BA, 0x21BA, 0xE1A9, 0x0000, 0x4529, 0x39C6, 0xB294, 0xE318, 0xA631, 0x38C6,   // 0x101F (7952) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x201F (7968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x301F (7984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x401F (8000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x501F (8016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x601F (8032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE739, 0xDFFF, 0x9ACE, 0x9ACE, 0x5184,   // 0x701F (8048) pixels
-0xDCD6, 0x55A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x2020, 0xE3EA, 0xC2EA, 0xA2E2, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x801F (8064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0xC058, 0xC058, 0xC050, 0xC050, 0xC050, 0xC048, 0xA040,   // 0x901F (8080) pixels
-0x6038, 0x6030, 0x4028, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA01F (8096) pixels
-0x0000, 0x0000, 0x8191, 0xC2EA, 0xC2EA, 0x41BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x59C6, 0xB294, 0xE318, 0xA631, 0x38C6,   // 0xB01F (8112) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC01F (8128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD01F (8144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE01F (8160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF01F (8176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (8192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE739, 0xDFF7, 0x9ACE, 0x7ACE, 0x5184,   // 0x1020 (8208) pixels
-0xFCD6, 0x76A5, 0x0000, 0x2020, 0xC048, 0xA048, 0x6089, 0xC2EA, 0xC2EA, 0xA2EA, 0x4081, 0x8048, 0xA048, 0xA048, 0xA048, 0xA048,   // 0x2020 (8224) pixels
-0xA048, 0xA048, 0x8048, 0x8048, 0x8048, 0x8040, 0x8040, 0x6040, 0x0069, 0x01BA, 0x21C2, 0x42C2, 0x42C2, 0x42C2, 0x62C2, 0x42C2,   // 0x3020 (8240) pixels
-0x42C2, 0x42C2, 0x41C2, 0x01B2, 0xA048, 0x8048, 0x8048, 0x8048, 0x8048, 0xA048, 0xA048, 0xA048, 0xA048, 0xA048, 0xA048, 0xA048,   // 0x4020 (8256) pixels
-0xA048, 0xA050, 0x21BA, 0xC2EA, 0xC2EA, 0x82D2, 0xC050, 0xA048, 0xA040, 0x0000, 0x6529, 0x7ACE, 0xB294, 0xE318, 0xA631, 0x38C6,   // 0x5020 (8272) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6020 (8288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7020 (8304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8020 (8320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9020 (8336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA020 (8352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC739, 0xBEF7, 0x9ACE, 0x7AC6, 0x5184,   // 0xB020 (8368) pixels
-0x1CDF, 0x96AD, 0x0000, 0x6081, 0x03EB, 0xE2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA,   // 0xC020 (8384) pixels
-0xE3EA, 0xE3EA, 0xE3EA, 0xC3EA, 0xE3EA, 0xE3EA, 0xC3EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xE3EA, 0xE3EA, 0xC2EA, 0xE2EA, 0xC2EA,   // 0xD020 (8400) pixels
-0xE2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA,   // 0xE020 (8416) pixels
-0xE3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE3EA, 0xE3EA, 0xC3DA, 0x0000, 0x6529, 0x7ACE, 0xB394, 0xE318, 0x8631, 0x38C6,   // 0xF020 (8432) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0021 (8448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1021 (8464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2021 (8480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3021 (8496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4021 (8512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC739, 0xBEF7, 0x9ACE, 0x9ACE, 0x5184,   // 0x5021 (8528) pixels
-0xFCDE, 0x96AD, 0x0000, 0x6081, 0x03EB, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xE2EA, 0xE3EA, 0xC2EA, 0xE2EA,   // 0x6021 (8544) pixels
-0xC2EA, 0xE2EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xC3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xC2EA, 0xC2EA, 0xC2EA,   // 0x7021 (8560) pixels
-0xE2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xE2EA, 0xE3EA,   // 0x8021 (8576) pixels
-0xE3EA, 0xE2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xA2DA, 0x0000, 0x6529, 0x7ACE, 0xB394, 0xE318, 0x8631, 0x38C6,   // 0x9021 (8592) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA021 (8608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB021 (8624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC021 (8640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD021 (8656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE021 (8672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA631, 0xFCDE, 0x9ACE, 0x9ACE, 0x5184,   // 0xF021 (8688) pixels
-0xFCD6, 0x96AD, 0x0000, 0x6081, 0xE3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xE2EA, 0xE2EA, 0xC2EA, 0xC2EA,   // 0x0022 (8704) pixels
-0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE3EA, 0xE2EA, 0xE2EA, 0xE2EA, 0xC2EA, 0xC2EA,   // 0x1022 (8720) pixels
-0xC2EA, 0xC2EA, 0xC3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xE2EA, 0xE2EA,   // 0x2022 (8736) pixels
-0xE3EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xC2EA, 0xA2DA, 0x0000, 0x6529, 0x79C6, 0xB394, 0xE318, 0x8631, 0x38C6,   // 0x3022 (8752) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4022 (8768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5022 (8784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6022 (8800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7022 (8816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8022 (8832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8629, 0xDBD6, 0x9ACE, 0xBBCE, 0x5184,   // 0x9022 (8848) pixels
-0xFCD6, 0x96AD, 0x0000, 0x4079, 0xC2E2, 0xA2E2, 0xA2E2, 0xA2E2, 0xA2E2, 0xC2E2, 0xC3E2, 0xC3E2, 0xC3E2, 0xC2E2, 0xC2E2, 0xC2E2,   // 0xA022 (8864) pixels
-0xC2E2, 0xC2E2, 0xC2E2, 0xC3E2, 0xC3E2, 0xC3E2, 0xC2E2, 0xC3E2, 0xC3E2, 0xC3E2, 0xC3E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2,   // 0xB022 (8880) pixels
-0xC2E2, 0xC2E2, 0xC3E2, 0xC3E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2, 0xC2E2,   // 0xC022 (8896) pixels
-0xC3E2, 0xC2E2, 0xC2E2, 0xA2E2, 0xA2E2, 0xA2E2, 0xA2E2, 0xC2E2, 0x82D2, 0x0000, 0x4521, 0x59C6, 0xB394, 0xE318, 0xA631, 0x38C6,   // 0xD022 (8912) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE022 (8928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF022 (8944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0023 (8960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1023 (8976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2023 (8992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0xFBD6, 0x9ACE, 0xBBCE, 0x5184,   // 0x3023 (9008) pixels
-0xDBD6, 0x96AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4023 (9024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5023 (9040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6023 (9056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x18BE, 0xD394, 0x0421, 0xA631, 0x38C6,   // 0x7023 (9072) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8023 (9088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9023 (9104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA023 (9120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB023 (9136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC023 (9152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0xFBD6, 0xBBCE, 0xBBCE, 0x3184,   // 0xD023 (9168) pixels
-0xBBD6, 0x76AD, 0x0000, 0xA210, 0xA631, 0xA631, 0xA631, 0xA631, 0xA639, 0xA631, 0xA631, 0x8631, 0x6529, 0x6529, 0x6529, 0x6529,   // 0xE023 (9184) pixels
-0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x2421, 0x2421, 0x0421, 0xE318, 0xC318, 0xA210, 0xA210, 0x8210, 0x8210, 0x8210,   // 0xF023 (9200) pixels
-0x8210, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4000, 0x2000, 0x2000, 0x2000, 0x2000,   // 0x0024 (9216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0xB6AD, 0xD394, 0x0421, 0xC739, 0x38C6,   // 0x1024 (9232) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2024 (9248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3024 (9264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4024 (9280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5024 (9296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6024 (9312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0xFBD6, 0xBBCE, 0xBBCE, 0x107C,   // 0x7024 (9328) pixels
-0x9ACE, 0x96AD, 0x0000, 0x928C, 0x5DE7, 0x5DE7, 0x5DEF, 0x5DEF, 0x5DEF, 0x5DE7, 0x3CE7, 0x1CE7, 0x1CE7, 0x1CDF, 0xFBDE, 0xFBDE,   // 0x8024 (9344) pixels
-0xFBDE, 0xFBDE, 0xFBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xBBD6, 0xBAD6, 0xBAD6, 0x9AD6, 0x9ACE, 0x79CE, 0x59CE, 0x39C6, 0x38C6, 0x18C6,   // 0x9024 (9360) pixels
-0x18BE, 0xF7BD, 0xD7BD, 0xB7B5, 0xB6B5, 0x96AD, 0x75AD, 0x55A5, 0x14A5, 0xF39C, 0xD394, 0xB294, 0x718C, 0x5184, 0x1084, 0xF07B,   // 0xA024 (9376) pixels
-0xCF73, 0x8E73, 0x4D6B, 0x0C5B, 0xCB5A, 0xAA52, 0x6A4A, 0x494A, 0x083A, 0x0000, 0x4529, 0xF49C, 0xD394, 0x0421, 0xC739, 0x38C6,   // 0xB024 (9392) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC024 (9408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD024 (9424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE024 (9440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF024 (9456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0025 (9472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0xFBD6, 0xBBCE, 0xBBCE, 0xF07B,   // 0x1025 (9488) pixels
-0x9ACE, 0xB7AD, 0x0000, 0x694A, 0x728C, 0x307C, 0x3084, 0x307C, 0x307C, 0x307C, 0x307C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C,   // 0x2025 (9504) pixels
-0x107C, 0x307C, 0x307C, 0x307C, 0x307C, 0x307C, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x307C, 0x3084, 0x3084, 0x3084, 0x307C,   // 0x3025 (9520) pixels
-0x3084, 0x307C, 0x3084, 0x3084, 0x3084, 0x3184, 0x3084, 0x3184, 0x3084, 0x3184, 0x3184, 0x3184, 0x3084, 0x3084, 0x3084, 0x3184,   // 0x4025 (9536) pixels
-0x3184, 0x3184, 0x5184, 0x5184, 0x518C, 0x518C, 0x5184, 0x5184, 0xCF73, 0x0000, 0xE739, 0x928C, 0xD394, 0x0421, 0xC739, 0x38C6,   // 0x5025 (9552) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6025 (9568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7025 (9584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8025 (9600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9025 (9616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA025 (9632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xDBD6, 0xBBCE, 0x9ACE, 0xCF7B,   // 0xB025 (9648) pixels
-0x9ACE, 0x59C6, 0x0421, 0x2000, 0xAE73, 0x5184, 0x5184, 0x5184, 0x3184, 0x3184, 0x307C, 0x307C, 0x307C, 0x307C, 0x307C, 0x3184,   // 0xC025 (9664) pixels
-0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184,   // 0xD025 (9680) pixels
-0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184, 0x3184,   // 0xE025 (9696) pixels
-0x3184, 0x3184, 0x5184, 0x5184, 0x518C, 0x518C, 0x5184, 0x3184, 0x694A, 0x0000, 0x4D63, 0x3184, 0xB394, 0x0421, 0xE739, 0x38C6,   // 0xF025 (9712) pixels
-0x9AD6, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0026 (9728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1026 (9744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2026 (9760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3026 (9776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4026 (9792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4521, 0xDBD6, 0x9BCE, 0x9ACE, 0xCF73,   // 0x5026 (9808) pixels
-0x9ACE, 0x9ACE, 0x928C, 0x0000, 0x0000, 0x8629, 0xE739, 0x083A, 0xE839, 0xE739, 0xE739, 0xE739, 0xE739, 0xE839, 0xE839, 0xE839,   // 0x6026 (9824) pixels
-0xE839, 0xE839, 0xE839, 0x083A, 0x083A, 0x083A, 0x083A, 0x083A, 0x083A, 0x083A, 0x083A, 0xE839, 0xE839, 0xE739, 0xE739, 0xE739,   // 0x7026 (9840) pixels
-0xC739, 0xC739, 0xC739, 0xC731, 0xC731, 0xC731, 0xC731, 0xC731, 0xC731, 0xC731, 0xC731, 0xC731, 0xC731, 0xA731, 0xA731, 0xA731,   // 0x8026 (9856) pixels
-0xA731, 0xC731, 0xC739, 0xC739, 0xE739, 0xE739, 0xA731, 0x0421, 0x0000, 0x8631, 0xB394, 0x107C, 0xD394, 0xE418, 0xE739, 0x38C6,   // 0x9026 (9872) pixels
-0x9AD6, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA026 (9888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB026 (9904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC026 (9920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD026 (9936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE026 (9952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0xDBD6, 0x9ACE, 0x9ACE, 0xCF73,   // 0xF026 (9968) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0xD394, 0xA631, 0x6108, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2100, 0x4108, 0x4108,   // 0x0027 (9984) pixels
-0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2100, 0x2000, 0x4100, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108,   // 0x1027 (10000) pixels
-0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108,   // 0x2027 (10016) pixels
-0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6529, 0xEF7B, 0x18BE, 0x3184, 0x107C, 0xF494, 0xE318, 0xC739, 0x18BE,   // 0x3027 (10032) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4027 (10048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5027 (10064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6027 (10080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7027 (10096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8027 (10112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0xBBCE, 0x9ACE, 0x9ACE, 0x6E6B,   // 0x9027 (10128) pixels
-0xBACE, 0x9ACE, 0xBACE, 0xBBCE, 0xBACE, 0xBBD6, 0x1CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3DE7, 0x3DE7,   // 0xA027 (10144) pixels
-0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x3DE7, 0x3DE7, 0x3DE7, 0x3DE7, 0x3DE7,   // 0xB027 (10160) pixels
-0x5DE7, 0x3DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x5DE7, 0x3CE7,   // 0xC027 (10176) pixels
-0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x3CE7, 0x5DEF, 0x1CE7, 0xDBD6, 0xBAD6, 0xF394, 0x107C, 0x5184, 0xD394, 0xE418, 0xC739, 0x18BE,   // 0xD027 (10192) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE027 (10208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF027 (10224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0028 (10240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1028 (10256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2028 (10272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0xBBCE, 0x9ACE, 0x9ACE, 0x3084,   // 0x3028 (10288) pixels
-0x38C6, 0xBACE, 0x9ACE, 0x9ACE, 0xBACE, 0xBACE, 0xBACE, 0xBAD6, 0xBBD6, 0xBBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6,   // 0x4028 (10304) pixels
-0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6,   // 0x5028 (10320) pixels
-0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6, 0xDBD6,   // 0x6028 (10336) pixels
-0xFBD6, 0xFBD6, 0xDBD6, 0xDBD6, 0xBBD6, 0xBBD6, 0xBAD6, 0x39C6, 0xB294, 0x107C, 0x107C, 0xD394, 0x3084, 0x4521, 0xE739, 0x38BE,   // 0x7028 (10352) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8028 (10368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9028 (10384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA028 (10400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB028 (10416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC028 (10432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0xBACE, 0x9ACE, 0x9ACE, 0x39BE,   // 0xD028 (10448) pixels
-0x8E6B, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE,   // 0xE028 (10464) pixels
-0x7AC6, 0x7AC6, 0x7ACE, 0x7AC6, 0x7AC6, 0x7AC6, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE,   // 0xF028 (10480) pixels
-0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7AC6, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE, 0x7ACE,   // 0x0029 (10496) pixels
-0x7ACE, 0x7ACE, 0x59C6, 0x59C6, 0x18BE, 0x76AD, 0xB394, 0x107C, 0xF07B, 0x107C, 0x928C, 0xB394, 0x2842, 0xE739, 0x2942, 0x79C6,   // 0x1029 (10512) pixels
-0x9ACE, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2029 (10528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3029 (10544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4029 (10560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5029 (10576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6029 (10592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0xBBCE, 0x9ACE, 0x9ACE, 0xBACE,   // 0x7029 (10608) pixels
-0xB6AD, 0xAA52, 0xCF73, 0x928C, 0x928C, 0x728C, 0x7184, 0x7184, 0x7184, 0x7184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184,   // 0x8029 (10624) pixels
-0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x3184, 0x317C, 0x307C, 0x3184, 0x3084, 0x3084, 0x3084,   // 0x9029 (10640) pixels
-0x307C, 0x307C, 0x307C, 0x3084, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C, 0x107C,   // 0xA029 (10656) pixels
-0xF07B, 0xCF73, 0x8E6B, 0x6D63, 0x4D63, 0x4D63, 0x4D63, 0x6D63, 0x6E6B, 0x8E6B, 0x4D63, 0xC739, 0xE739, 0x2842, 0x107C, 0xBACE,   // 0xB029 (10672) pixels
-0x7AC6, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC029 (10688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD029 (10704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE029 (10720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF029 (10736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x002A (10752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0419, 0xBBCE, 0xBACE, 0x9ACE, 0xBACE,   // 0x102A (10768) pixels
-0x9ACE, 0x59C6, 0x307C, 0x0319, 0xC318, 0xC318, 0xE318, 0xE318, 0x0419, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,   // 0x202A (10784) pixels
-0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xE318, 0xE318, 0xE318, 0xE318, 0x0421, 0x0421,   // 0x302A (10800) pixels
-0x0319, 0xE318, 0xE318, 0xE318, 0x0419, 0x0421, 0x0421, 0x0419, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,   // 0x402A (10816) pixels
-0x0421, 0x0421, 0x0421, 0x0421, 0x0319, 0xE318, 0xE318, 0xE318, 0x0421, 0x4529, 0xA731, 0x2842, 0x0842, 0x2C63, 0x79C6, 0xBACE,   // 0x502A (10832) pixels
-0x9AC6, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x602A (10848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x702A (10864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x802A (10880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x902A (10896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA02A (10912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0419, 0xBACE, 0xBACE, 0x9ACE, 0x9ACE,   // 0xB02A (10928) pixels
-0x9ACE, 0x9ACE, 0x79C6, 0xF494, 0x8E6B, 0xAB52, 0x8A4A, 0x8A52, 0x8A4A, 0x694A, 0x8A4A, 0x8A4A, 0x694A, 0x694A, 0x694A, 0x694A,   // 0xC02A (10944) pixels
-0x694A, 0x694A, 0x494A, 0x494A, 0x494A, 0x694A, 0x694A, 0x494A, 0x2942, 0x2942, 0x4942, 0x4942, 0x2842, 0x2842, 0x2842, 0x4942,   // 0xD02A (10960) pixels
-0x494A, 0x4942, 0x2842, 0x0842, 0x0842, 0x2842, 0x4942, 0x494A, 0x2842, 0x2842, 0x2842, 0x2842, 0x4942, 0x4942, 0x2842, 0x2842,   // 0xE02A (10976) pixels
-0x4942, 0x494A, 0x694A, 0x694A, 0x494A, 0x4942, 0x4942, 0x4942, 0x494A, 0x694A, 0x8A4A, 0x2C63, 0xF394, 0x9ACE, 0xBACE, 0xBACE,   // 0xF02A (10992) pixels
-0x9ACE, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x002B (11008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x102B (11024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x202B (11040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x302B (11056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x402B (11072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0419, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x502B (11088) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x9AC6, 0x9ACE, 0x7AC6,   // 0x602B (11104) pixels
-0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7ACE, 0x7ACE, 0x5AC6, 0x79C6, 0x7AC6, 0x7ACE, 0x7AC6, 0x79C6, 0x59C6, 0x7AC6,   // 0x702B (11120) pixels
-0x9ACE, 0x9ACE, 0x7AC6, 0x7AC6, 0x79C6, 0x7AC6, 0x9ACE, 0x7ACE, 0x7AC6, 0x59C6, 0x59C6, 0x7AC6, 0x9ACE, 0x7AC6, 0x79C6, 0x79C6,   // 0x802B (11136) pixels
-0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0xBACE, 0xBACE,   // 0x902B (11152) pixels
-0xBACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA02B (11168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB02B (11184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC02B (11200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD02B (11216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE02B (11232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0419, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xF02B (11248) pixels
-0x9AC6, 0x7AC6, 0x349D, 0xD394, 0x59C6, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x38BE, 0x149D, 0xF7B5, 0xBACE, 0x9ACE, 0x9ACE,   // 0x002C (11264) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x59C6, 0x39BE, 0x59C6, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x102C (11280) pixels
-0x9ACE, 0x59C6, 0x59C6, 0x39C6, 0x39BE, 0x59C6, 0x59C6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x7AC6, 0x7AC6, 0x7AC6,   // 0x202C (11296) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0xBACE,   // 0x302C (11312) pixels
-0x9ACE, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x402C (11328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x502C (11344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x602C (11360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x702C (11376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x802C (11392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC318, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x902C (11408) pixels
-0x7AC6, 0x928C, 0xC49A, 0x25B3, 0x8A52, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x18BE, 0xCB52, 0xF394, 0xEB5A, 0x96AD, 0x9ACE, 0x9ACE,   // 0xA02C (11424) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x96AD, 0xE318, 0x6108, 0x6108, 0xC318, 0xF7B5, 0xBACE, 0x9ACE,   // 0xB02C (11440) pixels
-0xD394, 0x6108, 0x6108, 0x8210, 0x6108, 0x6108, 0xA210, 0x76AD, 0x9ACE, 0x9ACE, 0x9ACE, 0x38BE, 0xEB5A, 0xA631, 0xC739, 0x8631,   // 0xC02C (11456) pixels
-0xCB52, 0xF49C, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0xD7B5, 0xCB52, 0x494A, 0xEB5A, 0x18B6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE,   // 0xD02C (11472) pixels
-0x9ACE, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE02C (11488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF02C (11504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x002D (11520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x102D (11536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x202D (11552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18BE, 0x9ACE, 0x9ACE, 0x9AC6,   // 0x302D (11568) pixels
-0x9AC6, 0x4D63, 0x27DC, 0x68EC, 0x2149, 0x59C6, 0x9ACE, 0x9ACE, 0x9AC6, 0x349D, 0xD394, 0x79C6, 0x35A5, 0x728C, 0x9ACE, 0x9ACE,   // 0x402D (11584) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x3184, 0x0000, 0x2000, 0xC310, 0x4008, 0xF49C, 0x9ACE, 0x9ACE,   // 0x502D (11600) pixels
-0x728C, 0xE739, 0x0842, 0x8110, 0x2421, 0x4429, 0x0000, 0xF394, 0x9ACE, 0x9ACE, 0x9ACE, 0xF394, 0x6529, 0x694A, 0xE739, 0x494A,   // 0x602D (11616) pixels
-0x0842, 0x2421, 0x79C6, 0x9ACE, 0x9ACE, 0xBACE, 0xEB5A, 0x4018, 0x2018, 0x0008, 0x728C, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x702D (11632) pixels
-0x38BE, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x802D (11648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x902D (11664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA02D (11680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB02D (11696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC02D (11712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF07B, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xD02D (11728) pixels
-0x9ACE, 0x55A5, 0xC261, 0x237A, 0xAE6B, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x39BE, 0xAA52, 0xB294, 0xAB52, 0xB6AD, 0x9ACE, 0x9ACE,   // 0xE02D (11744) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x18BE, 0x8A4A, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6AD, 0x9ACE, 0x9ACE,   // 0xF02D (11760) pixels
-0x728C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96AD, 0x9ACE, 0x9ACE, 0x9ACE, 0x18BE, 0x2842, 0x2000, 0x0000, 0x0000,   // 0x002E (11776) pixels
-0x0000, 0xF07B, 0x7AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x928C, 0x8631, 0xA631, 0x4942, 0xD7B5, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x102E (11792) pixels
-0x7184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x202E (11808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x302E (11824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x402E (11840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x502E (11856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x602E (11872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E6B, 0x18BE, 0x9ACE,   // 0x702E (11888) pixels
-0x9ACE, 0xBACE, 0xF8BD, 0x96AD, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x18BE, 0x149D, 0xF7B5, 0x9AC6, 0x9ACE, 0x9ACE,   // 0x802E (11904) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xD7B5, 0xB7AD, 0xD7B5, 0xF8B5, 0xF8BD, 0x18BE, 0x9AC6, 0x9AC6, 0x9ACE,   // 0x902E (11920) pixels
-0x9ACE, 0x18BE, 0x18BE, 0x18BE, 0x18BE, 0x18BE, 0x59C6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x59C6, 0xD7B5, 0xD7B5,   // 0xA02E (11936) pixels
-0x39BE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xB6AD, 0x8E6B,   // 0xB02E (11952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC02E (11968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD02E (11984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE02E (12000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF02E (12016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x002F (12032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB394, 0x9ACE,   // 0x102F (12048) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9AC6, 0x9AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x202F (12064) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x302F (12080) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x7AC6, 0x7AC6, 0x9ACE, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x402F (12096) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xF07B, 0x0000,   // 0x502F (12112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x602F (12128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x702F (12144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x802F (12160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x902F (12176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA02F (12192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB28C, 0x9ACE,   // 0xB02F (12208) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xC02F (12224) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x7AC6, 0xD7B5, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x5184, 0x718C, 0x5184, 0x518C,   // 0xD02F (12240) pixels
-0x518C, 0x5184, 0x5184, 0x5184, 0x5184, 0x728C, 0x928C, 0x38BE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0xE02F (12256) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xF07B, 0x0000,   // 0xF02F (12272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (12288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1030 (12304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2030 (12320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3030 (12336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4030 (12352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x928C, 0x9AC6,   // 0x5030 (12368) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x6030 (12384) pixels
-0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x38BE, 0xA631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7030 (12400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAB52, 0x7AC6, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,   // 0x8030 (12416) pixels
-0x9ACE, 0x7ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xBACE, 0x9ACE, 0x9ACE, 0x9ACE, 0xF07B, 0x0000,   // 0x9030 (12432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA030 (12448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB030 (12464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC030 (12480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD030 (12496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE030 (12512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE739, 0xEC5A,   // 0xF030 (12528) pixels
-0x0C5B, 0x2C63, 0x2C63, 0x2C63, 0x2C63, 0x0C5B, 0x0C63, 0x0C63, 0x2C63, 0x2C63, 0x2C63, 0x2C63, 0x2C63, 0x2C63, 0x2C63, 0x2C63,   // 0x0031 (12544) pixels
-0x2C63, 0x0C63, 0x0C63, 0x0C5B, 0xC739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1031 (12560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE839, 0xEC5A, 0x0C5B, 0x0C5B, 0x0C5B, 0x0C5B, 0x0C5B, 0x0C5B,   // 0x2031 (12576) pixels
-0x0C5B, 0x0C5B, 0x0C5B, 0x0C5B, 0x0C63, 0x0C5B, 0x0C5B, 0x0C5B, 0x0C5B, 0x0C63, 0x0C5B, 0x0C5B, 0xEB5A, 0xCB52, 0x6629, 0x0000,   // 0x3031 (12592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4031 (12608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5031 (12624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6031 (12640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7031 (12656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8031 (12672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9031 (12688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA031 (12704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB031 (12720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC031 (12736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD031 (12752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE031 (12768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF031 (12784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0032 (12800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1032 (12816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2032 (12832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3032 (12848) pixels
-0x0000, 0x0000, 0x4108, 0x7184, 0x5184, 0x5184, 0x517C, 0x317C, 0x4942, 0x4942, 0xE739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4032 (12864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5032 (12880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6032 (12896) pixels
-0x0000, 0x0000, 0x7284, 0x7284, 0x5184, 0x5184, 0x5184, 0x6A4A, 0x6A4A, 0x083A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7032 (12912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8032 (12928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9032 (12944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA032 (12960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB032 (12976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC032 (12992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD032 (13008) pixels
-0x0000, 0x0000, 0x6108, 0xD394, 0xD394, 0xD394, 0xD394, 0xB28C, 0x6A4A, 0x6A4A, 0xE839, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE032 (13024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF032 (13040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0033 (13056) pixels
-0x0000, 0x0000, 0xB394, 0xF394, 0xF394, 0xF494, 0xD394, 0xAB52, 0xAB4A, 0x4942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1033 (13072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2033 (13088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3033 (13104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4033 (13120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5033 (13136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6033 (13152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7033 (13168) pixels
-0x0000, 0x0000, 0x4108, 0xB394, 0xD394, 0xF394, 0xD394, 0xB28C, 0x6A4A, 0x4942, 0xA731, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8033 (13184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9033 (13200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA033 (13216) pixels
-0x0000, 0x0000, 0x728C, 0xF394, 0xF494, 0xF394, 0xB38C, 0xAA4A, 0xAA4A, 0x293A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB033 (13232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC033 (13248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD033 (13264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE033 (13280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF033 (13296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0034 (13312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1034 (13328) pixels
-0x0000, 0x0000, 0x4108, 0xD394, 0xD394, 0xD394, 0xF394, 0x928C, 0x6A4A, 0x4942, 0x6629, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2034 (13344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3034 (13360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4034 (13376) pixels
-0x0000, 0x0000, 0x5184, 0xF494, 0xF494, 0xF394, 0xB28C, 0xAA4A, 0xAA4A, 0x2942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5034 (13392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6034 (13408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7034 (13424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8034 (13440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9034 (13456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA034 (13472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB034 (13488) pixels
-0x0000, 0x0000, 0x4108, 0xF394, 0xF394, 0xD394, 0xD394, 0x7284, 0x8A4A, 0x6A4A, 0x4521, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC034 (13504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD034 (13520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE034 (13536) pixels
-0x0000, 0x0000, 0xEF7B, 0xF394, 0xF394, 0xF494, 0xB38C, 0xAA4A, 0x8A4A, 0x4942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF034 (13552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0035 (13568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1035 (13584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2035 (13600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3035 (13616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4035 (13632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5035 (13648) pixels
-0x0000, 0x0000, 0x0000, 0x4521, 0x2521, 0x2421, 0x2421, 0x0419, 0x8210, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6035 (13664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7035 (13680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8035 (13696) pixels
-0x0000, 0x0000, 0xC310, 0x2421, 0x2421, 0x2421, 0x0421, 0x6208, 0x6108, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9035 (13712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA035 (13728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB035 (13744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC035 (13760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD035 (13776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE035 (13792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF035 (13808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0036 (13824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1036 (13840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2036 (13856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3036 (13872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4036 (13888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5036 (13904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6036 (13920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7036 (13936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8036 (13952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9036 (13968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA036 (13984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB036 (14000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC036 (14016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD036 (14032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE036 (14048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF036 (14064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0037 (14080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1037 (14096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2037 (14112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3037 (14128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4037 (14144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5037 (14160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6037 (14176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7037 (14192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8037 (14208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9037 (14224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA037 (14240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB037 (14256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC037 (14272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD037 (14288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE037 (14304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF037 (14320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0038 (14336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1038 (14352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2038 (14368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3038 (14384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4038 (14400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5038 (14416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6038 (14432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x2842, 0x083A,   // 0x7038 (14448) pixels
-0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8038 (14464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9038 (14480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0xE839, 0x083A, 0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA038 (14496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB038 (14512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x8A4A, 0x4942, 0xA210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC038 (14528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD038 (14544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE038 (14560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF038 (14576) pixels
-0x0000, 0x0000, 0x6108, 0x7ACE, 0xDBD6, 0xFBDE, 0xAF73, 0x0000, 0x0000, 0x0000, 0x0000, 0x5184, 0xBBD6, 0xBBD6, 0xF7BD, 0x0000,   // 0x0039 (14592) pixels
-0x0000, 0x0000, 0x0000, 0x0C63, 0xDBD6, 0xBAD6, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E6B, 0x38BE, 0xFCDE, 0x1CDF, 0xFCDE,   // 0x1039 (14608) pixels
-0xDBD6, 0xF8BD, 0xAE73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7B, 0x9ACE, 0xBACE, 0xBBD6, 0xDBD6, 0xBBD6, 0x9ACE, 0x59C6,   // 0x2039 (14624) pixels
-0x96AD, 0x2C63, 0x0000, 0x0000, 0x0000, 0x0000, 0x14A5, 0xBBD6, 0xBBD6, 0xD39C, 0x0000, 0x0000, 0x0000, 0x0000, 0x34A5, 0xDBD6,   // 0x3039 (14640) pixels
-0xDBDE, 0x59CE, 0x4529, 0x0000, 0x0000, 0x8A4A, 0xB7B5, 0xDBD6, 0x1CDF, 0x1CDF, 0xFCDE, 0x18C6, 0x518C, 0x2521, 0x0000, 0x0000,   // 0x4039 (14656) pixels
-0x9294, 0xBBD6, 0xBBD6, 0xB294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96AD, 0xBAD6, 0xDBD6, 0xEF7B, 0x0000, 0x0000, 0x0000,   // 0x5039 (14672) pixels
-0x0000, 0x4108, 0x518C, 0x79CE, 0x3CE7, 0x3CE7, 0x1CE7, 0xFBDE, 0xB7B5, 0xEC5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18BE,   // 0x6039 (14688) pixels
-0xBBD6, 0xBBD6, 0xDBD6, 0xFCDE, 0xFBDE, 0xDBD6, 0x39C6, 0xD394, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7039 (14704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8039 (14720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9039 (14736) pixels
-0x0000, 0x0000, 0x0000, 0x75AD, 0x1CE7, 0x1CE7, 0x76AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x18BE, 0x1CE7, 0x1CDF, 0xFCDE, 0xE318,   // 0xA039 (14752) pixels
-0x0000, 0x0000, 0x0000, 0xD39C, 0x1CDF, 0x1CDF, 0xF49C, 0x0000, 0x0000, 0x0000, 0x55A5, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF,   // 0xB039 (14768) pixels
-0x1CDF, 0x1CDF, 0x1CDF, 0xD7B5, 0x2421, 0x0000, 0x0000, 0x0000, 0x107C, 0xFCDE, 0xFCDE, 0xFCDE, 0x1CDF, 0xFCDE, 0xFCDE, 0xFCDE,   // 0xC039 (14784) pixels
-0x1CDF, 0x1CDF, 0x9294, 0x0000, 0x0000, 0x0000, 0x55A5, 0xFCDE, 0xFBDE, 0xF39C, 0x0000, 0x0000, 0x0000, 0x9294, 0x1CDF, 0x1CE7,   // 0xD039 (14800) pixels
-0xFBDE, 0xCB5A, 0x0000, 0x0000, 0x0C63, 0xFCDE, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CE7, 0x1CE7, 0x1CDF, 0x1CDF, 0x59C6, 0x0000, 0x0000,   // 0xE039 (14816) pixels
-0xB394, 0x1CDF, 0x1CDF, 0xF39C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7B5, 0xFCDE, 0x1CDF, 0x1084, 0x0000, 0x0000, 0x0000,   // 0xF039 (14832) pixels
-0xA631, 0x18BE, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CDF, 0xF39C, 0x0000, 0x0000, 0x0000, 0x0000, 0x38C6,   // 0x003A (14848) pixels
-0xFCDE, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0xFBDE, 0x7ACE, 0xC739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x103A (14864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x203A (14880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x303A (14896) pixels
-0x0000, 0x0000, 0x0000, 0x6D6B, 0x1CE7, 0x1CDF, 0xBAD6, 0x0000, 0x0000, 0x0000, 0xC318, 0xFBD6, 0x1CDF, 0x1CDF, 0x1CDF, 0x6D6B,   // 0x403A (14912) pixels
-0x0000, 0x0000, 0x0000, 0xF8BD, 0x1CDF, 0x1CE7, 0x0C5B, 0x0000, 0x0000, 0xF39C, 0x1CDF, 0x1CDF, 0x1CDF, 0xDBD6, 0xB7B5, 0x96AD,   // 0x503A (14928) pixels
-0x7ACE, 0x1CDF, 0x1CDF, 0x1CDF, 0x18BE, 0x6108, 0x0000, 0x0000, 0x3084, 0xFCDE, 0xFCDE, 0x59CE, 0xF39C, 0xF39C, 0xF49C, 0xB7B5,   // 0x603A (14944) pixels
-0x1CDF, 0x1CDF, 0x1CDF, 0xCB5A, 0x0000, 0x0000, 0x55A5, 0x1CDF, 0xFCDE, 0xF39C, 0x0000, 0x0000, 0xEF7B, 0x1CDF, 0x1CE7, 0xFBDE,   // 0x703A (14960) pixels
-0x6D6B, 0x0000, 0x0000, 0x0000, 0x59C6, 0x1CDF, 0x1CDF, 0x79CE, 0x728C, 0x9294, 0xB6B5, 0xBBD6, 0x1CDF, 0x35A5, 0x0000, 0x0000,   // 0x803A (14976) pixels
-0xB394, 0x1CDF, 0x1CDF, 0xF39C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7BD, 0xFCDE, 0xFCDE, 0x1084, 0x0000, 0x0000, 0xA210,   // 0x903A (14992) pixels
-0x59C6, 0x1CE7, 0x1CE7, 0x1CE7, 0x79CE, 0x96AD, 0xB6B5, 0xBBD6, 0x1CE7, 0x1CE7, 0x1CE7, 0xD294, 0x0000, 0x0000, 0x0000, 0x39C6,   // 0xA03A (15008) pixels
-0x1CDF, 0x1CDF, 0x96AD, 0xF39C, 0xF39C, 0x55AD, 0xBAD6, 0x1CDF, 0x1CE7, 0xB6B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB03A (15024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC03A (15040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD03A (15056) pixels
-0x0000, 0x0000, 0x0000, 0x4108, 0xBAD6, 0x1CDF, 0x1CDF, 0xAA52, 0x0000, 0x0000, 0x8E6B, 0x1CE7, 0x1CDF, 0x1CDF, 0x1CDF, 0x34A5,   // 0xE03A (15072) pixels
-0x0000, 0x0000, 0x8210, 0xDBD6, 0x1CDF, 0xBAD6, 0x4108, 0x0000, 0x694A, 0x1CDF, 0x1CDF, 0x1CDF, 0xB6B5, 0x2421, 0x0000, 0x0000,   // 0xF03A (15088) pixels
-0x4108, 0x718C, 0xFCDE, 0x1CDF, 0xFCDE, 0xB294, 0x0000, 0x0000, 0x3084, 0x1CDF, 0xFCDE, 0xB7B5, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x003B (15104) pixels
-0x9294, 0x1CDF, 0x1CDF, 0x34A5, 0x0000, 0x0000, 0x55A5, 0x1CDF, 0xFCDE, 0xF39C, 0x0000, 0x2C63, 0xFBDE, 0x1CDF, 0x1CDF, 0xCF7B,   // 0x103B (15120) pixels
-0x0000, 0x0000, 0x0000, 0x0421, 0x1CE7, 0x1CDF, 0x1CDF, 0xAE73, 0x0000, 0x0000, 0x0000, 0xE318, 0x518C, 0xAA52, 0x0000, 0x0000,   // 0x203B (15136) pixels
-0xD394, 0x1CDF, 0x1CDF, 0xF39C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7B5, 0xFCDE, 0xFCDE, 0x3084, 0x0000, 0x0000, 0xD394,   // 0x303B (15152) pixels
-0x1CE7, 0x1CE7, 0x1CDF, 0x3084, 0x0000, 0x0000, 0x0000, 0x0421, 0x96AD, 0x1CE7, 0x1CE7, 0xFBDE, 0x494A, 0x0000, 0x0000, 0x59C6,   // 0x403B (15168) pixels
-0x1CDF, 0x1CDF, 0x6E6B, 0x0000, 0x0000, 0x0000, 0x494A, 0xFBDE, 0x1CE7, 0xFBDE, 0xA210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x503B (15184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x603B (15200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x703B (15216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x55A5, 0xFCDE, 0x1CDF, 0xD394, 0x0000, 0x0000, 0x55A5, 0x1CE7, 0x59C6, 0x59CE, 0x1CDF, 0x79CE,   // 0x803B (15232) pixels
-0x0000, 0x0000, 0x0C63, 0x1CDF, 0x1CDF, 0x75AD, 0x0000, 0x0000, 0x55A5, 0x1CDF, 0x1CDF, 0x59CE, 0x6108, 0x0000, 0x0000, 0x0000,   // 0x903B (15248) pixels
-0x0000, 0x0000, 0x55AD, 0x1CDF, 0x1CDF, 0xBAD6, 0x6108, 0x0000, 0x3084, 0xFCDE, 0xFCDE, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA03B (15264) pixels
-0xA631, 0x1CDF, 0x1CDF, 0xD7B5, 0x0000, 0x0000, 0x35A5, 0x1CDF, 0x1CDF, 0xF39C, 0xAA52, 0xDBD6, 0x1CE7, 0x1CDF, 0x518C, 0x0000,   // 0xB03B (15280) pixels
-0x0000, 0x0000, 0x0000, 0xA210, 0xFBDE, 0x1CDF, 0x1CE7, 0x18C6, 0x494A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC03B (15296) pixels
-0xF39C, 0x1CE7, 0x1CDF, 0xD394, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7BD, 0xFCDE, 0xFCDE, 0x1084, 0x0000, 0x2000, 0x9AD6,   // 0xD03B (15312) pixels
-0x1CE7, 0x1CE7, 0x14A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x59C6, 0x1CE7, 0x1CDF, 0x34A5, 0x0000, 0x0000, 0x59C6,   // 0xE03B (15328) pixels
-0x1CDF, 0x1CDF, 0x8E6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x38C6, 0x1CE7, 0x1CE7, 0xA631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF03B (15344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x003C (15360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x103C (15376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x4D6B, 0x1CDF, 0x3CE7, 0x38C6, 0x0000, 0x0000, 0x59C6, 0x1CDF, 0x34A5, 0x34A5, 0x1CDF, 0x1CDF,   // 0x203C (15392) pixels
-0xE739, 0x0000, 0xF39C, 0x1CDF, 0x1CDF, 0xAE73, 0x0000, 0x0000, 0x38C6, 0x1CDF, 0x1CDF, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x303C (15408) pixels
-0x0000, 0x0000, 0x8A4A, 0x1CDF, 0x1CDF, 0x1CDF, 0x8A4A, 0x0000, 0x107C, 0xFCDE, 0xFCDE, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x403C (15424) pixels
-0xCB52, 0x1CDF, 0x1CDF, 0xB7B5, 0x0000, 0x0000, 0x35A5, 0x1CDF, 0x1CDF, 0x96AD, 0xBAD6, 0x1CDF, 0x1CDF, 0x75AD, 0x0000, 0x0000,   // 0x503C (15440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0xB6B5, 0x1CE7, 0x1CE7, 0x1CE7, 0x1CE7, 0x39C6, 0xD39C, 0x694A, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x603C (15456) pixels
-0xF39C, 0x1CE7, 0x1CDF, 0x59C6, 0x96AD, 0x76AD, 0x96AD, 0xB6AD, 0xB6B5, 0xBAD6, 0xFCDE, 0xFCDE, 0x107C, 0x0000, 0xE739, 0x1CE7,   // 0x703C (15472) pixels
-0x1CE7, 0x1CE7, 0x2842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9294, 0x1CDF, 0x1CE7, 0x38C6, 0x0000, 0x0000, 0x39C6,   // 0x803C (15488) pixels
-0x1CDF, 0x1CDF, 0x8E73, 0x0000, 0x0000, 0x0000, 0x0000, 0x79CE, 0x1CE7, 0x3CE7, 0x8631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x903C (15504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA03C (15520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB03C (15536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0xDBD6, 0x3CE7, 0xFBDE, 0x0421, 0xC731, 0x1CDF, 0x1CE7, 0x8E6B, 0x8E6B, 0x1CE7, 0x1CE7,   // 0xC03C (15552) pixels
-0x3084, 0x0000, 0x18BE, 0x1CDF, 0xDBD6, 0xC318, 0x0000, 0x0000, 0x9ACE, 0x1CDF, 0x1CE7, 0xCF7B, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD03C (15568) pixels
-0x0000, 0x0000, 0x0419, 0xFCDE, 0x1CDF, 0x1CDF, 0x0C63, 0x0000, 0xEF7B, 0xFCDE, 0xFCDE, 0xD7BD, 0x4108, 0x4108, 0x4108, 0x083A,   // 0xE03C (15584) pixels
-0xF8BD, 0x1CDF, 0x1CDF, 0xB294, 0x0000, 0x0000, 0x34A5, 0x1CDF, 0x1CDF, 0xFCDE, 0xFCDE, 0x1CDF, 0x1CDF, 0xDBD6, 0xE739, 0x0000,   // 0xF03C (15600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x18C6, 0x3CE7, 0x1CE7, 0x1CDF, 0x1CDF, 0xFCDE, 0xFCDE, 0xD7B5, 0x8631, 0x0000, 0x0000,   // 0x003D (15616) pixels
-0xF39C, 0x1CE7, 0x1CDF, 0x1CDF, 0xFCDE, 0xFCDE, 0xFBDE, 0xFCDE, 0x1CDF, 0x1CDF, 0x1CDF, 0xFCDE, 0x107C, 0x0000, 0xAA52, 0x1CE7,   // 0x103D (15632) pixels
-0x1CE7, 0xFBDE, 0xA210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF73, 0x3CE7, 0x1CE7, 0xBAD6, 0x0000, 0x0000, 0x38C6,   // 0x203D (15648) pixels
-0xFCDE, 0x1CDF, 0xAF73, 0xC310, 0xA310, 0xA631, 0xF39C, 0x1CDF, 0x1CE7, 0x9AD6, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x303D (15664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x403D (15680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x503D (15696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96AD, 0x3CE7, 0x1CDF, 0x6E6B, 0xF07B, 0x1CDF, 0xFCDE, 0x0421, 0xE318, 0xFCDE, 0x1CDF,   // 0x603D (15712) pixels
-0x96B5, 0xC310, 0xFBDE, 0x1CDF, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x59C6, 0xFCDE, 0x1CDF, 0x518C, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x703D (15728) pixels
-0x0000, 0x0000, 0x8629, 0x1CDF, 0x1CDF, 0x1CDF, 0xAA52, 0x0000, 0xEF7B, 0xFCDE, 0xFCDE, 0xFCDE, 0xFBD6, 0xDBD6, 0xDBD6, 0xFCDE,   // 0x803D (15744) pixels
-0x1CDF, 0x3CE7, 0xDBD6, 0x6529, 0x0000, 0x0000, 0x34A5, 0x1CDF, 0xFCDE, 0x1CDF, 0xFCDE, 0xFCDE, 0x1CDF, 0x1CDF, 0xD7BD, 0x0000,   // 0x903D (15760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEC5A, 0x14A5, 0x38C6, 0xFBDE, 0xFCDE, 0x1CE7, 0x3CE7, 0x18C6, 0x0000, 0x0000,   // 0xA03D (15776) pixels
-0xF39C, 0x1CDF, 0x1CDF, 0x1CDF, 0xDBD6, 0xBAD6, 0xBAD6, 0x9AD6, 0xBAD6, 0xFBDE, 0x1CDF, 0xFCDE, 0x107C, 0x0000, 0x4842, 0x3CE7,   // 0xB03D (15792) pixels
-0x1CE7, 0x1CDF, 0x8631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3084, 0x1CE7, 0x1CE7, 0x79CE, 0x0000, 0x0000, 0x38C6,   // 0xC03D (15808) pixels
-0x1CDF, 0x1CDF, 0xFCDE, 0xFCDE, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x5184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD03D (15824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE03D (15840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF03D (15856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAE73, 0x1CDF, 0x1CDF, 0x14A5, 0x75A5, 0xFCDE, 0x18BE, 0x0000, 0x0000, 0x18BE, 0x1CDF,   // 0x003E (15872) pixels
-0x9AD6, 0x6D63, 0x1CDF, 0x3CE7, 0x1084, 0x0000, 0x0000, 0x0000, 0x96AD, 0xFCDE, 0xFCDE, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x103E (15888) pixels
-0x0000, 0x0000, 0x107C, 0x1CDF, 0x1CDF, 0xFCDE, 0xE318, 0x0000, 0x107C, 0xFCDE, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF,   // 0x203E (15904) pixels
-0x1CE7, 0x7ACE, 0x8A4A, 0x0000, 0x0000, 0x0000, 0x35A5, 0x1CDF, 0xFCDE, 0xFCDE, 0xF8BD, 0x3084, 0x1CDF, 0x1CDF, 0x1CDF, 0x718C,   // 0x303E (15920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x76AD, 0x3CE7, 0x1CE7, 0x1CE7, 0x0842, 0x0000,   // 0x403E (15936) pixels
-0xF39C, 0x1CDF, 0x1CDF, 0x34A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7BD, 0xFCDE, 0xFCDE, 0x3084, 0x0000, 0xA210, 0xDBD6,   // 0x503E (15952) pixels
-0x1CDF, 0x1CDF, 0x3084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6B5, 0x1CDF, 0x1CE7, 0xB6B5, 0x0000, 0x0000, 0x39C6,   // 0x603E (15968) pixels
-0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CE7, 0x3CE7, 0x1CE7, 0xFBDE, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x703E (15984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x803E (16000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x903E (16016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0319, 0xDBD6, 0x1CDF, 0x59C6, 0x7ACE, 0xFCDE, 0x928C, 0x0000, 0x0000, 0xB294, 0x1CDF,   // 0xA03E (16032) pixels
-0x1CDF, 0xB6AD, 0x1CDF, 0xFCDE, 0x6529, 0x0000, 0x0000, 0x0000, 0x6D6B, 0x1CDF, 0xFCDE, 0xFCDE, 0x5184, 0x0000, 0x0000, 0x0000,   // 0xB03E (16048) pixels
-0x0000, 0x083A, 0x9ACE, 0x1CDF, 0x1CDF, 0x96AD, 0x0000, 0x0000, 0x107C, 0x1CDF, 0x1CDF, 0x59CE, 0x928C, 0x928C, 0x149D, 0x3CE7,   // 0xC03E (16064) pixels
-0x1CE7, 0x59C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x55A5, 0x1CE7, 0xFCDE, 0x59C6, 0x6529, 0x0000, 0xB6B5, 0x1CDF, 0x1CDF, 0xFBD6,   // 0xD03E (16080) pixels
-0xCB5A, 0x0000, 0x0000, 0xE318, 0x59CE, 0x8E73, 0x0000, 0x0000, 0x0000, 0x0000, 0xC318, 0x1CDF, 0x1CDF, 0x1CDF, 0xCB5A, 0x0000,   // 0xE03E (16096) pixels
-0xF39C, 0x1CDF, 0x1CDF, 0x149D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7BD, 0xFCDE, 0x1CDF, 0x3084, 0x0000, 0x0000, 0x75AD,   // 0xF03E (16112) pixels
-0x1CDF, 0x1CDF, 0xBAD6, 0x694A, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7B, 0xFCDE, 0x1CDF, 0x1CDF, 0x6D6B, 0x0000, 0x0000, 0x59C6,   // 0x003F (16128) pixels
-0x1CDF, 0x1CDF, 0x96AD, 0xF39C, 0xF39C, 0xD394, 0xEF7B, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x103F (16144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x203F (16160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x303F (16176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7B5, 0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0x083A, 0x0000, 0x0000, 0xAA52, 0x1CDF,   // 0x403F (16192) pixels
-0x1CDF, 0x1CDF, 0xFCDE, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6B5, 0x1CDF, 0xFCDE, 0xFCDE, 0xD7B5, 0x3084, 0x8E6B,   // 0x503F (16208) pixels
-0xF39C, 0xBAD6, 0xFCDE, 0xFCDE, 0xBAD6, 0xC739, 0x0000, 0x0000, 0x107C, 0x1CDF, 0x1CDF, 0xD7BD, 0x0000, 0x0000, 0x0000, 0x59C6,   // 0x603F (16224) pixels
-0x1CDF, 0xFCDE, 0x107C, 0x0000, 0x0000, 0x0000, 0x34A5, 0x1CDF, 0x1CDF, 0x928C, 0x0000, 0x0000, 0x8631, 0x9ACE, 0x1CDF, 0x1CDF,   // 0x703F (16240) pixels
-0x79CE, 0x0421, 0x0000, 0xAE73, 0x3CE7, 0x1CE7, 0x38C6, 0x928C, 0x0C63, 0xEB5A, 0x55AD, 0x1CDF, 0x1CDF, 0xFBDE, 0x4421, 0x0000,   // 0x803F (16256) pixels
-0xF39C, 0x1CDF, 0x1CDF, 0x149D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18BE, 0xFCDE, 0x1CDF, 0x3084, 0x0000, 0x0000, 0xE739,   // 0x903F (16272) pixels
-0xBBD6, 0x1CDF, 0x1CDF, 0xBBD6, 0xF39C, 0xAE73, 0xCF73, 0x96AD, 0x1CDF, 0x1CDF, 0x1CDF, 0xB6B5, 0x0000, 0x0000, 0x0000, 0x59C6,   // 0xA03F (16288) pixels
-0x1CDF, 0x1CDF, 0xAE73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB03F (16304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC03F (16320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD03F (16336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5184, 0x1CDF, 0x1CDF, 0x1CDF, 0x59C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xBAD6,   // 0xE03F (16352) pixels
-0x1CDF, 0x1CDF, 0x1CDF, 0x3084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x18BE, 0x1CDF, 0x1CDF, 0x1CDF, 0x3CDF, 0x3CDF,   // 0xF03F (16368) pixels
-0x1CDF, 0x1CDF, 0x1CDF, 0x9ACE, 0xCB5A, 0x0000, 0x0000, 0x0000, 0xEF7B, 0x1CDF, 0x1CDF, 0xF7BD, 0x0000, 0x0000, 0x0000, 0x8E73,   // 0x0040 (16384) pixels
-0x1CDF, 0x1CDF, 0x9AD6, 0x4529, 0x0000, 0x0000, 0x14A5, 0x1CDF, 0xFCDE, 0x34A5, 0x0000, 0x0000, 0x0000, 0xAE73, 0x1CDF, 0x1CDF,   // 0x1040 (16400) pixels
-0x3CE7, 0x75AD, 0x0000, 0x518C, 0x1CE7, 0x1CE7, 0x1CDF, 0x1CE7, 0x3DE7, 0x3CE7, 0x1CDF, 0x1CDF, 0x1CE7, 0xF39C, 0x0000, 0x0000,   // 0x2040 (16416) pixels
-0x149D, 0x1CDF, 0x1CDF, 0x149D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18BE, 0x1CDF, 0xFCDE, 0x3084, 0x0000, 0x0000, 0x0000,   // 0x3040 (16432) pixels
-0x0C63, 0xBAD6, 0x1CDF, 0x1CDF, 0x1CE7, 0x3CE7, 0x1CDF, 0x1CDF, 0x1CE7, 0x3CE7, 0x38C6, 0x0421, 0x0000, 0x0000, 0x0000, 0x38C6,   // 0x4040 (16448) pixels
-0x1CDF, 0x1CDF, 0xAE73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5040 (16464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6040 (16480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7040 (16496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA631, 0x3CE7, 0x3DE7, 0x3CE7, 0x14A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x96AD,   // 0x8040 (16512) pixels
-0x3CDF, 0x1CDF, 0x1CDF, 0x8631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0xD39C, 0xDBD6, 0x3DE7, 0x1CDF, 0x1CDF,   // 0x9040 (16528) pixels
-0x1CDF, 0xFCDE, 0x75AD, 0xA631, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7B, 0x1CDF, 0x1CDF, 0xF7BD, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA040 (16544) pixels
-0x18C6, 0x3CE7, 0x3CE7, 0x55AD, 0x0000, 0x0000, 0x34A5, 0x1CDF, 0x1CDF, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x75AD, 0x5DE7,   // 0xB040 (16560) pixels
-0x3DE7, 0x3CE7, 0xAE73, 0x0000, 0x8A52, 0x55AD, 0xDBD6, 0x3CE7, 0x3CE7, 0x3CE7, 0x1CE7, 0xDBD6, 0x9294, 0x0000, 0x0000, 0x0000,   // 0xC040 (16576) pixels
-0x149D, 0x3DE7, 0x1CDF, 0x34A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18BE, 0x1CE7, 0x1CDF, 0x3084, 0x0000, 0x0000, 0x0000,   // 0xD040 (16592) pixels
-0x0000, 0xE739, 0x96AD, 0x1CDF, 0x3DE7, 0x3CE7, 0x1CDF, 0x1CDF, 0xBAD6, 0xD394, 0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 0x38C6,   // 0xE040 (16608) pixels
-0x1CDF, 0x1CDF, 0xCF73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF040 (16624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0041 (16640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1041 (16656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4942, 0xAA52, 0xAA52, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529,   // 0x2041 (16672) pixels
-0xCB52, 0xCB5A, 0x8A52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x0C63, 0x107C, 0x1084,   // 0x3041 (16688) pixels
-0x4D63, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xCB5A, 0xCB5A, 0x2842, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4041 (16704) pixels
-0x6529, 0x8A52, 0x8A52, 0x494A, 0x0000, 0x0000, 0x8631, 0x4942, 0x4842, 0xC739, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0xAA52,   // 0x5041 (16720) pixels
-0xAA52, 0xAA52, 0xE739, 0x0000, 0x0000, 0x0000, 0xC318, 0x2C63, 0x3084, 0x3084, 0x2C63, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6041 (16736) pixels
-0xA631, 0xCB52, 0xAA52, 0xC739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x083A, 0x694A, 0x694A, 0x4421, 0x0000, 0x0000, 0x0000,   // 0x7041 (16752) pixels
-0x0000, 0x0000, 0x0000, 0x6529, 0xAF73, 0x718C, 0x3084, 0xEB5A, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4942,   // 0x8041 (16768) pixels
-0xAA52, 0xAA52, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9041 (16784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA041 (16800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB041 (16816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC041 (16832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD041 (16848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE041 (16864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF041 (16880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0042 (16896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1042 (16912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2042 (16928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3042 (16944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4042 (16960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5042 (16976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6042 (16992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7042 (17008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8042 (17024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9042 (17040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA042 (17056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB042 (17072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC042 (17088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD042 (17104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE042 (17120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF042 (17136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0043 (17152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1043 (17168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2043 (17184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3043 (17200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4043 (17216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5043 (17232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6043 (17248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7043 (17264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8043 (17280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9043 (17296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA043 (17312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB043 (17328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC043 (17344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD043 (17360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE043 (17376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF043 (17392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0044 (17408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1044 (17424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2044 (17440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3044 (17456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4044 (17472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5044 (17488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6044 (17504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7044 (17520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8044 (17536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9044 (17552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA044 (17568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB044 (17584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC044 (17600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD044 (17616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE044 (17632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF044 (17648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2051, 0x62A2,   // 0x0045 (17664) pixels
-0xC3BA, 0x83AA, 0x4069, 0x0000, 0x0000, 0x0000, 0x0059, 0x62A2, 0x4161, 0x0000, 0x0000, 0x0000, 0xA171, 0xA3AA, 0xC040, 0x0000,   // 0x1045 (17680) pixels
-0x2061, 0x42A2, 0x42A2, 0x42A2, 0x63A2, 0x63A2, 0x2151, 0x0000, 0x0000, 0x229A, 0xE291, 0x0000, 0x0000, 0x0000, 0xA179, 0x42AA,   // 0x2045 (17696) pixels
-0x2018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3045 (17712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4045 (17728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5045 (17744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6045 (17760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7045 (17776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8045 (17792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9045 (17808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0292, 0x84E3, 0x44DB,   // 0xA045 (17824) pixels
-0x03CB, 0x44DB, 0x63E3, 0x2292, 0x0000, 0x0000, 0xC048, 0x64EB, 0xE3C2, 0x0000, 0x0000, 0x0000, 0x24D3, 0x85E3, 0x2018, 0x0000,   // 0xB045 (17840) pixels
-0xE289, 0x44EB, 0x03D3, 0x03CB, 0x04CB, 0x24D3, 0x8169, 0x0000, 0x0000, 0x23E3, 0x84EB, 0x0292, 0x0000, 0x0000, 0xA3B2, 0x85EB,   // 0xC045 (17856) pixels
-0x8030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD045 (17872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE045 (17888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF045 (17904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0046 (17920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1046 (17936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2046 (17952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3046 (17968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4061, 0x84EB, 0x03CB, 0x8038,   // 0x4046 (17984) pixels
-0x0000, 0x4028, 0xE3C2, 0x84EB, 0x4161, 0x0000, 0x0000, 0x03CB, 0xA4EB, 0xA038, 0x0000, 0x0051, 0x84EB, 0xA3A2, 0x0000, 0x0000,   // 0x5046 (18000) pixels
-0x0192, 0x84EB, 0x0051, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x44E3, 0x84EB, 0x84EB, 0x2061, 0x0000, 0x82B2, 0x84EB,   // 0x6046 (18016) pixels
-0x8030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7046 (18032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8046 (18048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9046 (18064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA046 (18080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB046 (18096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC046 (18112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD046 (18128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63AA, 0x84EB, 0x8171, 0x0000,   // 0xE046 (18144) pixels
-0x0000, 0x0000, 0x2059, 0x85EB, 0xA3AA, 0x0000, 0x0000, 0xE289, 0x84EB, 0x0292, 0x0000, 0x63A2, 0x84EB, 0xE048, 0x0000, 0x0000,   // 0xF046 (18160) pixels
-0x2292, 0x85EB, 0x83AA, 0x4292, 0x0292, 0xE281, 0x0000, 0x0000, 0x0008, 0x64E3, 0x24CB, 0x44DB, 0x23DB, 0x6030, 0x82B2, 0x84EB,   // 0x0047 (18176) pixels
-0xA030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1047 (18192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2047 (18208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3047 (18224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4047 (18240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5047 (18256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6047 (18272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0xBAD6, 0xBAD6,   // 0x7047 (18288) pixels
-0xBAD6, 0x9ACE, 0x9ACE, 0xBAD6, 0x9AD6, 0x9AD6, 0xCF7B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3BA, 0xA4EB, 0x0051, 0x0000,   // 0x8047 (18304) pixels
-0x0000, 0x0000, 0xC040, 0x84EB, 0xE3BA, 0x0000, 0x0000, 0x6028, 0x63E3, 0x03CB, 0x0018, 0x65DB, 0xE3C2, 0x0000, 0x0000, 0x0000,   // 0x9047 (18320) pixels
-0x2192, 0x85EB, 0x64DB, 0x44D3, 0x24D3, 0xC3C2, 0x0000, 0x0000, 0x0008, 0x85E3, 0x04C3, 0x6169, 0x63E3, 0xA2C2, 0xA3B2, 0xA5EB,   // 0xA047 (18336) pixels
-0xA030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD394, 0xBAD6, 0x9AD6, 0x9ACE, 0x9ACE, 0x9ACE, 0xBAD6, 0xBAD6, 0x99CE, 0x0000,   // 0xB047 (18352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC047 (18368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD047 (18384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE047 (18400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF047 (18416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0048 (18432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0xCF7B, 0xEF7B,   // 0x1048 (18448) pixels
-0xCF7B, 0xCF73, 0xCF7B, 0xEF7B, 0xEF7B, 0xEF7B, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x429A, 0x84EB, 0x018A, 0x0000,   // 0x2048 (18464) pixels
-0x0000, 0x0000, 0xE189, 0xA4EB, 0x62A2, 0x0000, 0x0000, 0x0000, 0xA2B2, 0x84EB, 0xE191, 0xC5EB, 0xC179, 0x0000, 0x0000, 0x0000,   // 0x3048 (18480) pixels
-0x018A, 0x84EB, 0x4059, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x84E3, 0x03C3, 0x0000, 0x2192, 0x83EB, 0x84EB, 0xA4EB,   // 0x4048 (18496) pixels
-0x8030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A52, 0xCF7B, 0xCF7B, 0xCF73, 0xAE73, 0xAF73, 0xCF73, 0xCF7B, 0xAE73, 0x0000,   // 0x5048 (18512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x6048 (18528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7048 (18544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x8048 (18560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9048 (18576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA048 (18592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB048 (18608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8038, 0x43DB, 0x43E3, 0x0192,   // 0xC048 (18624) pixels
-0x4161, 0x0292, 0x64E3, 0x64DB, 0xA038, 0x0000, 0x0000, 0x0000, 0x6069, 0x84EB, 0x84EB, 0x64DB, 0x0008, 0x0000, 0x0000, 0x0000,   // 0xD048 (18640) pixels
-0x018A, 0x64E3, 0xC179, 0x4159, 0x4159, 0x4161, 0x6028, 0x0000, 0x0008, 0x64DB, 0xE3C2, 0x0000, 0x0000, 0xE3C2, 0xC4F3, 0xA4EB,   // 0xE048 (18656) pixels
-0x8030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF048 (18672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0049 (18688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1049 (18704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2049 (18720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3049 (18736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x4049 (18752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x5049 (18768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2059, 0x23D3, 0x84E3,   // 0x6049 (18784) pixels
-0x84E3, 0x84EB, 0x44D3, 0x6161, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x44D3, 0xC4EB, 0x429A, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x7049 (18800) pixels
-0x018A, 0x64E3, 0x64E3, 0x64E3, 0xA5E3, 0xC5EB, 0xE279, 0x0000, 0x0008, 0x64E3, 0xE3BA, 0x0000, 0x0000, 0x6028, 0x64DB, 0x83EB,   // 0x8049 (18816) pixels
-0x8030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x9049 (18832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA049 (18848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB049 (18864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC049 (18880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD049 (18896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE049 (18912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF049 (18928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x4061,   // 0x004A (18944) pixels
-0xC179, 0x4061, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE048, 0x4061, 0x2018, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x104A (18960) pixels
-0x6028, 0xE050, 0xE048, 0xE048, 0x0051, 0x2051, 0x6028, 0x0000, 0x0000, 0xC040, 0x8038, 0x0000, 0x0000, 0x0000, 0x6030, 0xC048,   // 0x204A (18976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x304A (18992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x404A (19008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x504A (19024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x604A (19040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x704A (19056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x804A (19072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x904A (19088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA04A (19104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB04A (19120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC04A (19136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD04A (19152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE04A (19168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF04A (19184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x004B (19200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x104B (19216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x204B (19232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x304B (19248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x404B (19264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x504B (19280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x604B (19296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x704B (19312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x804B (19328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x904B (19344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA04B (19360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB04B (19376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC04B (19392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD04B (19408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE04B (19424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF04B (19440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x004C (19456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x104C (19472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x204C (19488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x304C (19504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x404C (19520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x504C (19536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x604C (19552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x704C (19568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x804C (19584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x904C (19600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA04C (19616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB04C (19632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC04C (19648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD04C (19664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE04C (19680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF04C (19696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x004D (19712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x104D (19728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x204D (19744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x304D (19760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x404D (19776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x504D (19792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x604D (19808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x704D (19824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x804D (19840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x904D (19856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA04D (19872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB04D (19888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC04D (19904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD04D (19920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE04D (19936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF04D (19952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x004E (19968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x104E (19984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x204E (20000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x304E (20016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x404E (20032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x504E (20048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x604E (20064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x704E (20080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x804E (20096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x904E (20112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA04E (20128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB04E (20144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC04E (20160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD04E (20176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE04E (20192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF04E (20208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x004F (20224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x104F (20240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x204F (20256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x304F (20272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x404F (20288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x504F (20304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x604F (20320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x704F (20336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x804F (20352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x904F (20368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xA04F (20384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xB04F (20400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xC04F (20416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xD04F (20432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xE04F (20448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0xF04F (20464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (20480) pixels
-};
-
+#define LOGO_WIDTH 160
+#define LOGO_HEIGHT 128
 
+// 9059 bytes RLE, 40960 uncompressed
+const uint8_t logoRle[9059] PROGMEM={
+0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x81, 0x08, 0x00, 0x83, 0x00, 0x00, 0x82, 0x08, 0x00, 0x84, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x10, 0x00, 0xFF, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x03, 0x42, 0x28, 0x73, 0xAF, 0x31, 0xA6, 0xBA,
+0xE2, 0x81, 0xF4, 0x24, 0x83, 0xEB, 0xE3, 0x00, 0xEB, 0xE4, 0x83, 0xEC, 0x04, 0x82, 0xEC, 0x03,
+0x06, 0xEC, 0x04, 0xF4, 0x24, 0xF3, 0xE2, 0xAA, 0x41, 0x42, 0x48, 0x6B, 0x6E, 0x31, 0xA6, 0xFF,
+0x00, 0x00, 0x85, 0x00, 0x00, 0x04, 0x84, 0x51, 0xCE, 0x9A, 0xC6, 0x59, 0x6B, 0x4D, 0xCB, 0x22,
+0x81, 0xFB, 0xE2, 0x88, 0xFB, 0xC2, 0x81, 0xFB, 0xE2, 0x81, 0xFB, 0xC2, 0x06, 0xFB, 0xE2, 0xF3,
+0x81, 0xC2, 0x80, 0x84, 0x51, 0xBE, 0x38, 0xB6, 0x18, 0x63, 0x2C, 0xFF, 0x00, 0x00, 0x83, 0x00,
+0x00, 0x06, 0x4A, 0x69, 0xD6, 0xBB, 0xBE, 0x18, 0x94, 0xB2, 0x4A, 0x49, 0xB2, 0x80, 0xF3, 0x40,
+0x81, 0xF3, 0x60, 0x13, 0xE3, 0x20, 0xDB, 0x00, 0xD2, 0xC0, 0xDA, 0xE0, 0xE3, 0x00, 0xEB, 0x00,
+0xE3, 0x00, 0xDA, 0xE0, 0xD2, 0xE1, 0xE3, 0x21, 0xEB, 0x40, 0xF3, 0x61, 0xF3, 0x40, 0xEB, 0x00,
+0xB2, 0x40, 0x5A, 0xEC, 0x94, 0xF3, 0xC6, 0x39, 0xAD, 0xB7, 0x29, 0x65, 0xFF, 0x00, 0x00, 0x82,
+0x00, 0x00, 0x02, 0xA5, 0x34, 0xCE, 0x9A, 0x94, 0xF3, 0x82, 0x00, 0x00, 0x02, 0x30, 0x60, 0x28,
+0x40, 0x20, 0x20, 0x83, 0x00, 0x00, 0x01, 0x08, 0x00, 0x18, 0x20, 0x83, 0x00, 0x00, 0x03, 0x10,
+0x00, 0x28, 0x40, 0x30, 0x60, 0x08, 0x00, 0x82, 0x00, 0x00, 0x02, 0xB5, 0xD7, 0xB5, 0xF7, 0x63,
+0x2C, 0xFF, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0xAD, 0x75, 0xC6, 0x59, 0x94, 0x92, 0x96, 0x00,
+0x00, 0x02, 0xB5, 0xB7, 0xBE, 0x18, 0x63, 0x4D, 0xFF, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0xAD,
+0x55, 0xC6, 0x59, 0x94, 0x92, 0x96, 0x00, 0x00, 0x02, 0xB5, 0xB6, 0xBE, 0x18, 0x63, 0x4D, 0xFF,
+0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0xA5, 0x34, 0xC6, 0x59, 0x8C, 0x92, 0x96, 0x00, 0x00, 0x02,
+0xAD, 0x96, 0xB5, 0xD7, 0x63, 0x2C, 0xFF, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x9D, 0x14, 0xBE,
+0x18, 0x8C, 0x72, 0x96, 0x00, 0x00, 0x02, 0xAD, 0x96, 0xB5, 0xD7, 0x63, 0x0C, 0xFF, 0x00, 0x00,
+0x82, 0x00, 0x00, 0x02, 0x4A, 0x69, 0x63, 0x4D, 0x42, 0x49, 0x96, 0x00, 0x00, 0x02, 0x52, 0xCB,
+0x5A, 0xEB, 0x21, 0x45, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x92, 0x00, 0x00, 0x06, 0x31, 0xA6,
+0xA5, 0x14, 0xD6, 0xBA, 0xE7, 0x3C, 0xEF, 0x5D, 0xE7, 0x5D, 0xE7, 0x3C, 0x88, 0xE7, 0x1C, 0x81,
+0xDF, 0x1C, 0x00, 0xE7, 0x1C, 0x84, 0xE7, 0x3C, 0x86, 0xE7, 0x1C, 0x00, 0xDF, 0x1C, 0x83, 0xDF,
+0x1B, 0x82, 0xE7, 0x1C, 0x81, 0xE7, 0x3C, 0x87, 0xE7, 0x1C, 0x81, 0xDF, 0x1C, 0x00, 0xDF, 0x1B,
+0x84, 0xDE, 0xFB, 0x03, 0xDE, 0xDB, 0xBD, 0xF7, 0x7B, 0xEF, 0x10, 0xA2, 0xE1, 0x00, 0x00, 0x04,
+0x9C, 0xD3, 0xEF, 0x7D, 0xF7, 0xDE, 0xEF, 0x9D, 0xE7, 0x5D, 0x81, 0xE7, 0x3C, 0x00, 0xE7, 0x3D,
+0x82, 0xE7, 0x3C, 0x01, 0xE7, 0x3D, 0xE7, 0x5D, 0x81, 0xEF, 0x5D, 0x82, 0xE7, 0x5D, 0x02, 0xE7,
+0x3C, 0xE7, 0x5C, 0xE7, 0x5D, 0x84, 0xEF, 0x5D, 0x84, 0xE7, 0x5D, 0x82, 0xEF, 0x5D, 0x83, 0xE7,
+0x5D, 0x81, 0xEF, 0x5D, 0x00, 0xE7, 0x5D, 0x84, 0xE7, 0x3C, 0x00, 0xE7, 0x3D, 0x81, 0xE7, 0x5D,
+0x00, 0xE7, 0x5C, 0x81, 0xE7, 0x3C, 0x04, 0xE7, 0x1C, 0xDF, 0x1C, 0xDE, 0xFC, 0xDE, 0xFB, 0xD6,
+0xDB, 0x81, 0xD6, 0xBB, 0x81, 0xD6, 0xDB, 0x01, 0xC6, 0x38, 0x63, 0x4D, 0xDF, 0x00, 0x00, 0x05,
+0xBD, 0xD7, 0xFF, 0xFF, 0xEF, 0x5D, 0xCE, 0x9A, 0xBE, 0x38, 0xB5, 0xB6, 0x83, 0xAD, 0x75, 0x00,
+0xAD, 0x55, 0x8B, 0xA5, 0x55, 0x01, 0xAD, 0x75, 0xAD, 0x76, 0x81, 0xAD, 0x96, 0x00, 0xAD, 0x76,
+0x84, 0xAD, 0x75, 0x01, 0xAD, 0x76, 0xAD, 0x95, 0x81, 0xAD, 0x76, 0x83, 0xAD, 0x96, 0x00, 0xAD,
+0x75, 0x82, 0xAD, 0x55, 0x01, 0xAD, 0x75, 0xAD, 0x76, 0x87, 0xAD, 0x96, 0x83, 0xAD, 0xB6, 0x01,
+0xBD, 0xF8, 0xC6, 0x7A, 0x82, 0xCE, 0x9A, 0x00, 0x84, 0x30, 0xDD, 0x00, 0x00, 0x09, 0xA5, 0x14,
+0xFF, 0xFF, 0xE7, 0x3C, 0xC6, 0x7A, 0x94, 0xD3, 0x6B, 0x6D, 0xA5, 0x34, 0xB5, 0xB6, 0xBD, 0xD7,
+0xBD, 0xF7, 0x83, 0xBD, 0xD7, 0x8A, 0xB5, 0xB6, 0x85, 0xB5, 0x96, 0x02, 0xAD, 0x95, 0xAD, 0x75,
+0xAD, 0x55, 0x81, 0xA5, 0x55, 0x00, 0xAD, 0x55, 0x81, 0xAD, 0x75, 0x82, 0xB5, 0x96, 0x81, 0xAD,
+0x75, 0x00, 0xAD, 0x55, 0x81, 0xAD, 0x75, 0x8A, 0xB5, 0x96, 0x04, 0xB5, 0x95, 0xAD, 0x75, 0x94,
+0xD3, 0x6B, 0x6D, 0xA5, 0x35, 0x81, 0xCE, 0x9A, 0x01, 0xCE, 0xBA, 0x6B, 0x6D, 0xDB, 0x00, 0x00,
+0x06, 0x4A, 0x69, 0xF7, 0xBE, 0xE7, 0x5D, 0xCE, 0xBA, 0x8C, 0x71, 0xB5, 0xB6, 0xF7, 0xDE, 0x81,
+0xFF, 0xDE, 0x00, 0xF7, 0xDE, 0x83, 0xF7, 0xBE, 0x86, 0xF7, 0x9E, 0x81, 0xF7, 0xBE, 0x84, 0xEF,
+0x9E, 0x86, 0xF7, 0x9E, 0x01, 0xEF, 0x9E, 0xF7, 0x9E, 0x84, 0xEF, 0x9E, 0x85, 0xEF, 0x7D, 0x81,
+0xE7, 0x5D, 0x81, 0xE7, 0x3C, 0x00, 0xDF, 0x1C, 0x81, 0xD6, 0xFB, 0x83, 0xD6, 0xDB, 0x01, 0xD6,
+0xBB, 0xCE, 0xBA, 0x81, 0xCE, 0x9A, 0x05, 0x94, 0xB2, 0x94, 0xD3, 0xCE, 0xBA, 0xCE, 0x9A, 0xC6,
+0x39, 0x18, 0xC3, 0xDA, 0x00, 0x00, 0x09, 0xBE, 0x17, 0xF7, 0xBE, 0xC6, 0x9A, 0xAD, 0x96, 0xA5,
+0x34, 0xFF, 0xFF, 0xF7, 0xBE, 0xD6, 0xFB, 0xCE, 0x9A, 0xC6, 0x7A, 0x8E, 0xCE, 0x9A, 0x81, 0xC6,
+0x9A, 0xA3, 0xCE, 0x9A, 0x02, 0xCE, 0xBA, 0x73, 0xCF, 0xB5, 0xD7, 0x81, 0xCE, 0x9A, 0x00, 0x7B,
+0xEF, 0xD9, 0x00, 0x00, 0x08, 0x10, 0xA2, 0xF7, 0x9E, 0xE7, 0x5D, 0xCE, 0x9A, 0x6B, 0x8E, 0xEF,
+0x7D, 0xEF, 0x9E, 0xCE, 0x9A, 0xC6, 0x7A, 0x81, 0xCE, 0xBA, 0x8D, 0xCE, 0x9A, 0x81, 0xCE, 0xBA,
+0x90, 0xCE, 0x9A, 0x82, 0xCE, 0xBA, 0x91, 0xCE, 0x9A, 0x04, 0xAD, 0xB6, 0x52, 0xAA, 0xC6, 0x59,
+0xCE, 0x9A, 0xAD, 0x76, 0xD9, 0x00, 0x00, 0x0A, 0x4A, 0x69, 0xFF, 0xFF, 0xD6, 0xFB, 0xCE, 0x9A,
+0x7C, 0x10, 0xF7, 0xBE, 0xD6, 0xBB, 0xC6, 0x7A, 0xE7, 0x5D, 0xFF, 0xDF, 0xF7, 0xDE, 0x8C, 0xCE,
+0x9A, 0x02, 0xBE, 0x38, 0x63, 0x4D, 0x29, 0x86, 0x82, 0x29, 0x65, 0x00, 0x29, 0x66, 0x87, 0x29,
+0x86, 0x01, 0x31, 0x86, 0x29, 0x86, 0x81, 0x31, 0x86, 0x03, 0x31, 0xA6, 0x39, 0xE7, 0x7C, 0x10,
+0xC6, 0x59, 0x91, 0xCE, 0x9A, 0x05, 0xB5, 0xD7, 0x21, 0x04, 0x84, 0x30, 0xCE, 0x9A, 0xC6, 0x38,
+0x00, 0x41, 0xD8, 0x00, 0x00, 0x0A, 0x5A, 0xCB, 0xFF, 0xFF, 0xD6, 0xBB, 0xCE, 0x9A, 0x8C, 0x51,
+0xF7, 0xBE, 0xC6, 0x7A, 0xD6, 0xFB, 0xFF, 0xFF, 0xF7, 0xDE, 0xD6, 0xFB, 0x8B, 0xCE, 0x9A, 0x01,
+0xC6, 0x9A, 0x4A, 0x69, 0x94, 0x00, 0x00, 0x00, 0x63, 0x2C, 0x91, 0xCE, 0x9A, 0x05, 0xAD, 0x96,
+0x21, 0x24, 0x42, 0x08, 0xCE, 0x9A, 0xC6, 0x7A, 0x10, 0xA2, 0xD8, 0x00, 0x00, 0x09, 0x52, 0xCA,
+0xFF, 0xDF, 0xCE, 0xBA, 0xCE, 0x9A, 0x8C, 0x71, 0xF7, 0xDF, 0xCE, 0x9A, 0xEF, 0x7D, 0xF7, 0xDE,
+0xD6, 0xBB, 0x8C, 0xCE, 0x9A, 0x00, 0xBE, 0x18, 0x95, 0x00, 0x00, 0x01, 0x08, 0x82, 0xC6, 0x59,
+0x90, 0xCE, 0x9A, 0x05, 0xAD, 0x76, 0x21, 0x24, 0x31, 0xA6, 0xC6, 0x59, 0xCE, 0x7A, 0x10, 0xC3,
+0xD8, 0x00, 0x00, 0x01, 0x52, 0xAA, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x05, 0x8C, 0x71, 0xF7, 0xBF,
+0xCE, 0xBA, 0xEF, 0x7D, 0xE7, 0x3C, 0xC6, 0x9A, 0x8C, 0xCE, 0x9A, 0x01, 0xC6, 0x79, 0x18, 0xE4,
+0x94, 0x00, 0x00, 0x00, 0x31, 0xA6, 0x91, 0xCE, 0x9A, 0x05, 0xAD, 0x76, 0x21, 0x04, 0x31, 0x86,
+0xC6, 0x39, 0xCE, 0x7A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x52, 0xAA, 0xFF, 0xDF, 0x81, 0xCE,
+0x9A, 0x04, 0x8C, 0x71, 0xF7, 0xBE, 0xCE, 0xBA, 0xD6, 0xBB, 0xCE, 0xBA, 0x81, 0xCE, 0x9A, 0x82,
+0xC6, 0x9A, 0x88, 0xCE, 0x9A, 0x02, 0xC6, 0x7A, 0x94, 0xD3, 0x00, 0x20, 0x92, 0x00, 0x00, 0x01,
+0x10, 0xA2, 0xA5, 0x55, 0x91, 0xCE, 0x9A, 0x05, 0xA5, 0x76, 0x21, 0x04, 0x29, 0x65, 0xC6, 0x38,
+0xCE, 0x7A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x06, 0x52, 0x8A, 0xFF, 0xDF, 0xCE, 0x9A, 0xC6, 0x7A,
+0x8C, 0x51, 0xF7, 0x9E, 0xCE, 0xBA, 0x83, 0xCE, 0x9A, 0x81, 0xC6, 0x9A, 0x87, 0xCE, 0x9A, 0x00,
+0xCE, 0x7A, 0x82, 0xC6, 0x7A, 0x00, 0xB5, 0xD7, 0x81, 0xA5, 0x35, 0x00, 0xA5, 0x34, 0x81, 0x9D,
+0x34, 0x8D, 0x9D, 0x14, 0x02, 0xB6, 0x18, 0xC6, 0x7A, 0xC6, 0x9A, 0x90, 0xCE, 0x9A, 0x05, 0xA5,
+0x55, 0x18, 0xE3, 0x29, 0x65, 0xC6, 0x38, 0xCE, 0x7A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x06, 0x4A,
+0x8A, 0xFF, 0xDF, 0xCE, 0x9A, 0xC6, 0x7A, 0x84, 0x51, 0xEF, 0x7D, 0xCE, 0xBA, 0x83, 0xCE, 0x9A,
+0x83, 0xC6, 0x9A, 0x85, 0xCE, 0x9A, 0x83, 0xC6, 0x7A, 0x00, 0xC6, 0x9A, 0x81, 0xCE, 0x9A, 0x84,
+0xCE, 0x7A, 0x82, 0xC6, 0x7A, 0x02, 0xCE, 0x7A, 0xCE, 0x9A, 0xCE, 0x7A, 0x85, 0xCE, 0x9A, 0x82,
+0xC6, 0x7A, 0x00, 0xC6, 0x9A, 0x8F, 0xCE, 0x9A, 0x05, 0xA5, 0x35, 0x18, 0xE3, 0x29, 0x65, 0xC6,
+0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x0A, 0x4A, 0x8A, 0xFF, 0xDF, 0xCE, 0x9A, 0xC6,
+0x7A, 0x84, 0x31, 0xE7, 0x5D, 0xCE, 0x9A, 0xCE, 0xBA, 0xC6, 0x79, 0x9D, 0x34, 0x94, 0xB2, 0x8A,
+0x8C, 0x92, 0x81, 0x8C, 0x72, 0x88, 0x8C, 0x92, 0x00, 0x8C, 0x72, 0x8C, 0x8C, 0x92, 0x00, 0x8C,
+0x72, 0x8B, 0x8C, 0x92, 0x02, 0x94, 0xB3, 0xAD, 0xB6, 0xC6, 0x9A, 0x81, 0xC6, 0x7A, 0x05, 0x9D,
+0x35, 0x18, 0xE3, 0x29, 0x65, 0xC6, 0x39, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x08, 0x4A,
+0x69, 0xFF, 0xFF, 0xCE, 0xBA, 0xC6, 0x7A, 0x84, 0x31, 0xE7, 0x5D, 0xCE, 0x9A, 0xB5, 0xD7, 0x29,
+0x65, 0xB4, 0x00, 0x00, 0x08, 0x6B, 0x6D, 0xC6, 0x59, 0xC6, 0x7A, 0x9D, 0x14, 0x18, 0xE3, 0x31,
+0x86, 0xC6, 0x59, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x0A, 0x4A, 0x69, 0xFF, 0xFF, 0xCE,
+0xBA, 0xC6, 0x7A, 0x84, 0x31, 0xE7, 0x5D, 0xC6, 0x7A, 0x4A, 0x69, 0x00, 0x00, 0x73, 0x8E, 0xB5,
+0xB6, 0x81, 0xBD, 0xD7, 0x86, 0xB5, 0xB6, 0x88, 0xBD, 0xD7, 0x87, 0xB5, 0xB6, 0x83, 0xB5, 0x96,
+0x00, 0xAD, 0x96, 0x83, 0xAD, 0x75, 0x18, 0xAD, 0x55, 0xA5, 0x34, 0xA5, 0x14, 0x9C, 0xF3, 0x94,
+0xD3, 0x94, 0x92, 0x8C, 0x71, 0x8C, 0x51, 0x84, 0x30, 0x84, 0x10, 0x7B, 0xCF, 0x73, 0x8E, 0x6B,
+0x4D, 0x5B, 0x0C, 0x42, 0x49, 0x08, 0x41, 0x00, 0x00, 0x8C, 0xB2, 0xC6, 0x7A, 0x9D, 0x14, 0x19,
+0x04, 0x31, 0xA6, 0xC6, 0x59, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x0B, 0x4A, 0x49, 0xFF,
+0xFF, 0xCE, 0xBA, 0xCE, 0x7A, 0x84, 0x30, 0xE7, 0x5D, 0xB5, 0xD7, 0x00, 0x00, 0x39, 0xE7, 0xE7,
+0x1B, 0xCE, 0x59, 0xC6, 0x38, 0x82, 0xC6, 0x18, 0x01, 0xBE, 0x18, 0xBD, 0xF8, 0x82, 0xBD, 0xF7,
+0x85, 0xBD, 0xD7, 0x81, 0xB5, 0xD7, 0x82, 0xB5, 0xB6, 0x81, 0xB5, 0x96, 0x01, 0xAD, 0x96, 0xAD,
+0x76, 0x81, 0xAD, 0x75, 0x81, 0xAD, 0x55, 0x0B, 0xA5, 0x55, 0xA5, 0x34, 0x9D, 0x14, 0x9C, 0xF3,
+0x9C, 0xD3, 0x94, 0xB2, 0x94, 0x92, 0x8C, 0x71, 0x84, 0x51, 0x84, 0x30, 0x7C, 0x10, 0x7B, 0xF0,
+0x83, 0x7B, 0xEF, 0x83, 0x7C, 0x10, 0x81, 0x7B, 0xEF, 0x09, 0x52, 0xAA, 0x00, 0x00, 0x4A, 0x69,
+0xCE, 0x9A, 0xA5, 0x34, 0x21, 0x04, 0x31, 0xA6, 0xC6, 0x59, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00,
+0x00, 0x0C, 0x4A, 0x49, 0xFF, 0xFF, 0xCE, 0xBA, 0xCE, 0x9A, 0x84, 0x51, 0xE7, 0x5D, 0xAD, 0x96,
+0x00, 0x00, 0x63, 0x2C, 0x8C, 0x71, 0x7C, 0x30, 0x84, 0x30, 0x84, 0x31, 0x81, 0x84, 0x30, 0x00,
+0x84, 0x10, 0x84, 0x7C, 0x10, 0x02, 0x7C, 0x30, 0x7C, 0x10, 0x84, 0x30, 0x8E, 0x7C, 0x10, 0x87,
+0x7B, 0xF0, 0x81, 0x7C, 0x10, 0x83, 0x7B, 0xF0, 0x01, 0x7C, 0x10, 0x84, 0x10, 0x83, 0x84, 0x30,
+0x81, 0x7C, 0x10, 0x09, 0x6B, 0x6D, 0x00, 0x00, 0x31, 0xA6, 0xCE, 0x9A, 0xA5, 0x35, 0x21, 0x24,
+0x31, 0xA6, 0xC6, 0x59, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x42, 0x49, 0xFF, 0xDF,
+0x81, 0xCE, 0x9A, 0x07, 0x84, 0x51, 0xE7, 0x3D, 0xAD, 0x75, 0x00, 0x00, 0x31, 0xA6, 0x52, 0xCB,
+0x52, 0xAB, 0x52, 0xCB, 0x82, 0x5A, 0xCB, 0x00, 0x52, 0xCB, 0x84, 0x52, 0xAA, 0x83, 0x52, 0xCB,
+0x81, 0x52, 0xAA, 0x00, 0x52, 0xAB, 0x90, 0x52, 0xAA, 0x81, 0x52, 0xAB, 0x81, 0x52, 0xCB, 0x00,
+0x52, 0xAB, 0x82, 0x52, 0xAA, 0x00, 0x52, 0xCB, 0x83, 0x5A, 0xCB, 0x0C, 0x52, 0xCB, 0x52, 0xAB,
+0x52, 0xCB, 0x4A, 0x49, 0x00, 0x00, 0x29, 0x86, 0xCE, 0x9A, 0xA5, 0x34, 0x21, 0x24, 0x31, 0xA6,
+0xC6, 0x59, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x06, 0x42, 0x28, 0xFF, 0xFF, 0xCE, 0xBA,
+0xCE, 0x9A, 0x8C, 0x51, 0xE7, 0x5D, 0xAD, 0x75, 0xB7, 0x00, 0x00, 0x07, 0x29, 0x65, 0xCE, 0x9A,
+0xA5, 0x34, 0x21, 0x24, 0x31, 0xA6, 0xC6, 0x59, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01,
+0x42, 0x28, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x04, 0x8C, 0x51, 0xE7, 0x5D, 0xAD, 0x76, 0x00, 0x00,
+0x48, 0xA0, 0x82, 0x99, 0xA1, 0x02, 0x40, 0x80, 0x00, 0x00, 0x58, 0xC0, 0x88, 0x99, 0xC1, 0x89,
+0x99, 0xA1, 0x00, 0x99, 0xC1, 0x81, 0x99, 0xA1, 0x81, 0x99, 0xC1, 0x88, 0x99, 0xA1, 0x85, 0x99,
+0xC1, 0x04, 0x99, 0xA1, 0x91, 0x81, 0x08, 0x00, 0x00, 0x00, 0x69, 0x00, 0x81, 0x91, 0x81, 0x09,
+0x81, 0x61, 0x00, 0x00, 0x29, 0x65, 0xCE, 0x7A, 0xA5, 0x14, 0x21, 0x04, 0x31, 0x86, 0xC6, 0x38,
+0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x42, 0x08, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x04,
+0x8C, 0x51, 0xE7, 0x5D, 0xAD, 0x96, 0x00, 0x00, 0x79, 0x20, 0x81, 0xE2, 0xC2, 0x08, 0xD2, 0x82,
+0x10, 0x00, 0x00, 0x00, 0xC2, 0x62, 0xEA, 0xE3, 0xEA, 0xC2, 0xEA, 0xE2, 0xEA, 0xC3, 0xEA, 0xE3,
+0x81, 0xEA, 0xC3, 0x88, 0xEA, 0xC2, 0x8A, 0xEA, 0xC3, 0x81, 0xEA, 0xC2, 0x00, 0xEA, 0xC3, 0x82,
+0xEA, 0xC2, 0x81, 0xEA, 0xC3, 0x82, 0xEA, 0xE3, 0x82, 0xEA, 0xC2, 0x0E, 0x81, 0x40, 0x00, 0x00,
+0x69, 0x00, 0xE2, 0xA2, 0xE2, 0xC2, 0xD2, 0x82, 0x00, 0x00, 0x29, 0x86, 0xCE, 0x7A, 0x9D, 0x14,
+0x19, 0x04, 0x31, 0x86, 0xC6, 0x39, 0xCE, 0x9A, 0x18, 0xE3, 0xD8, 0x00, 0x00, 0x01, 0x42, 0x08,
+0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x09, 0x8C, 0x71, 0xEF, 0x5D, 0xAD, 0x96, 0x00, 0x00, 0x79, 0x40,
+0xEA, 0xE3, 0xEA, 0xC2, 0x91, 0x80, 0x00, 0x00, 0x58, 0xC0, 0x82, 0xEA, 0xC2, 0x81, 0xEA, 0xE2,
+0x81, 0xEA, 0xC3, 0x85, 0xEA, 0xC2, 0x91, 0xEA, 0xC3, 0x83, 0xEA, 0xC2, 0x03, 0xEA, 0xC3, 0xEA,
+0xE3, 0xEA, 0xC3, 0xEA, 0xE3, 0x82, 0xEA, 0xC2, 0x00, 0xCA, 0x42, 0x81, 0x00, 0x00, 0x0B, 0xC2,
+0x41, 0xE2, 0xE2, 0xD2, 0xA2, 0x00, 0x00, 0x29, 0x65, 0xCE, 0x9A, 0x9C, 0xF4, 0x18, 0xE3, 0x31,
+0x86, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xE3, 0xD8, 0x00, 0x00, 0x0D, 0x42, 0x08, 0xFF, 0xDF, 0xCE,
+0x9A, 0xC6, 0x7A, 0x8C, 0x71, 0xE7, 0x5D, 0xAD, 0x96, 0x00, 0x00, 0x79, 0x41, 0xEB, 0x03, 0xE2,
+0xC2, 0x28, 0x40, 0x00, 0x00, 0xB2, 0x01, 0x83, 0xEA, 0xC2, 0x00, 0xEA, 0xE2, 0x87, 0xEA, 0xC2,
+0x88, 0xEA, 0xC3, 0x00, 0xEA, 0xC2, 0x87, 0xEA, 0xC3, 0x84, 0xEA, 0xC2, 0x82, 0xEA, 0xC3, 0x82,
+0xEA, 0xC2, 0x0E, 0xEA, 0xA2, 0x71, 0x20, 0x00, 0x00, 0x71, 0x20, 0xEA, 0xE3, 0xD2, 0xA2, 0x00,
+0x00, 0x29, 0x66, 0xCE, 0x9A, 0x9C, 0xF3, 0x18, 0xE3, 0x31, 0x86, 0xC6, 0x39, 0xCE, 0x9A, 0x18,
+0xC3, 0xD8, 0x00, 0x00, 0x12, 0x42, 0x08, 0xFF, 0xDF, 0xCE, 0x9A, 0xC6, 0x7A, 0x84, 0x51, 0xE7,
+0x5D, 0xAD, 0x96, 0x00, 0x00, 0x60, 0xE0, 0xBA, 0x62, 0x89, 0x81, 0x00, 0x00, 0x40, 0x60, 0xE2,
+0xA2, 0xEA, 0xC2, 0xEA, 0xA2, 0xDA, 0x82, 0xB2, 0x01, 0xB2, 0x21, 0x81, 0xB2, 0x01, 0x00, 0xAA,
+0x01, 0x85, 0xB2, 0x01, 0x00, 0xB2, 0x21, 0x8B, 0xB2, 0x01, 0x00, 0xB2, 0x21, 0x8A, 0xB2, 0x01,
+0x01, 0xBA, 0x01, 0xE2, 0xA2, 0x81, 0xEA, 0xA2, 0x0D, 0xCA, 0x41, 0x00, 0x00, 0x08, 0x00, 0xAA,
+0x02, 0xAA, 0x22, 0x00, 0x00, 0x29, 0x65, 0xCE, 0x7A, 0x94, 0xD3, 0x18, 0xE3, 0x31, 0x86, 0xC6,
+0x39, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x3A, 0x08, 0xFF, 0xDF, 0x81, 0xCE, 0x9A,
+0x02, 0x84, 0x51, 0xE7, 0x3D, 0xAD, 0x76, 0x84, 0x00, 0x00, 0x00, 0xB1, 0xE1, 0x82, 0xEA, 0xC2,
+0x00, 0x81, 0x40, 0xA4, 0x00, 0x00, 0x00, 0xB1, 0xE1, 0x82, 0xEA, 0xC2, 0x00, 0x79, 0x20, 0x83,
+0x00, 0x00, 0x07, 0x21, 0x65, 0xC6, 0x59, 0x94, 0xD3, 0x18, 0xE3, 0x31, 0x86, 0xC6, 0x39, 0xCE,
+0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x3A, 0x08, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x08, 0x84,
+0x51, 0xDF, 0x1C, 0xA5, 0x55, 0x00, 0x00, 0x38, 0x60, 0x79, 0x61, 0x81, 0x61, 0xAA, 0x01, 0xEA,
+0xC3, 0x82, 0xEA, 0xC2, 0x00, 0xCA, 0x62, 0x81, 0x81, 0x81, 0x84, 0x81, 0x61, 0x81, 0x81, 0x81,
+0x81, 0x89, 0x81, 0x86, 0x81, 0x81, 0x81, 0x81, 0x61, 0x01, 0x81, 0x81, 0x81, 0x61, 0x87, 0x81,
+0x81, 0x00, 0x81, 0x61, 0x83, 0x79, 0x61, 0x02, 0x81, 0x61, 0x89, 0x81, 0xDA, 0xA2, 0x82, 0xEA,
+0xC2, 0x0C, 0xE2, 0xC3, 0x99, 0xE1, 0x81, 0x61, 0x69, 0x21, 0x00, 0x00, 0x21, 0x65, 0xC6, 0x59,
+0x94, 0xB3, 0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x39, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01,
+0x39, 0xE7, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x06, 0x84, 0x31, 0xDE, 0xFC, 0xA5, 0x55, 0x00, 0x00,
+0x79, 0x40, 0xEA, 0xE3, 0xF2, 0xE3, 0x82, 0xEA, 0xE3, 0x01, 0xEA, 0xC2, 0xEA, 0xE2, 0x88, 0xEA,
+0xC2, 0x00, 0xEA, 0xC3, 0x8B, 0xEA, 0xC2, 0x86, 0xEA, 0xC3, 0x01, 0xEA, 0xE3, 0xEA, 0xC3, 0x89,
+0xEA, 0xC2, 0x00, 0xEA, 0xE2, 0x81, 0xEA, 0xE3, 0x0A, 0xEA, 0xC2, 0xD2, 0x62, 0x00, 0x00, 0x29,
+0x65, 0xC6, 0x59, 0x94, 0xB2, 0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x39, 0xCE, 0x9A, 0x18, 0xC3, 0xD8,
+0x00, 0x00, 0x01, 0x39, 0xE7, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x05, 0x84, 0x31, 0xD6, 0xFC, 0xA5,
+0x55, 0x00, 0x00, 0x79, 0x40, 0xEA, 0xC2, 0x81, 0xEA, 0xE2, 0x82, 0xEA, 0xE3, 0x00, 0xEA, 0xE2,
+0xA6, 0xEA, 0xC2, 0x83, 0xEA, 0xE2, 0x81, 0xEA, 0xC2, 0x09, 0xD2, 0x82, 0x00, 0x00, 0x29, 0x65,
+0xC6, 0x59, 0x94, 0x92, 0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x39, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00,
+0x00, 0x01, 0x39, 0xE7, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x06, 0x84, 0x31, 0xD6, 0xFC, 0xA5, 0x55,
+0x00, 0x00, 0x79, 0x40, 0xEA, 0xC2, 0xEA, 0xE2, 0x81, 0xEA, 0xE3, 0x81, 0xEA, 0xE2, 0x81, 0xEA,
+0xC2, 0x82, 0xEA, 0xA2, 0xA2, 0xEA, 0xC2, 0x83, 0xEA, 0xE2, 0x0B, 0xEA, 0xC2, 0xEA, 0xE2, 0xD2,
+0x82, 0x00, 0x00, 0x29, 0x65, 0xC6, 0x39, 0x8C, 0x92, 0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x39, 0xCE,
+0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x39, 0xE7, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x0C, 0x84,
+0x31, 0xD6, 0xDC, 0xA5, 0x55, 0x00, 0x00, 0x58, 0xE0, 0xBA, 0x41, 0xBA, 0x22, 0xD2, 0xA2, 0xEA,
+0xE3, 0xEA, 0xE2, 0xEA, 0xC2, 0xCA, 0x42, 0xAA, 0x01, 0x83, 0xA9, 0xE1, 0x82, 0xAA, 0x01, 0x84,
+0xA9, 0xE1, 0x00, 0xCA, 0x41, 0x81, 0xEA, 0xA2, 0x01, 0xEA, 0xC2, 0xEA, 0xC3, 0x82, 0xEA, 0xE3,
+0x82, 0xEA, 0xC2, 0x01, 0xE2, 0xA2, 0xB2, 0x01, 0x85, 0xAA, 0x01, 0x85, 0xA9, 0xE1, 0x04, 0xB2,
+0x01, 0xE2, 0xC2, 0xEA, 0xE2, 0xEA, 0xE3, 0xEA, 0xE2, 0x81, 0xBA, 0x21, 0x09, 0xA9, 0xE1, 0x00,
+0x00, 0x29, 0x45, 0xC6, 0x39, 0x94, 0xB2, 0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x38, 0xCE, 0x9A, 0x18,
+0xC3, 0xD8, 0x00, 0x00, 0x01, 0x39, 0xE7, 0xFF, 0xDF, 0x81, 0xCE, 0x9A, 0x02, 0x84, 0x51, 0xD6,
+0xDC, 0xA5, 0x55, 0x83, 0x00, 0x00, 0x04, 0x20, 0x20, 0xEA, 0xE3, 0xEA, 0xC2, 0xE2, 0xA2, 0x18,
+0x00, 0x8C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x81, 0x58, 0xC0, 0x82, 0x50, 0xC0, 0x05, 0x48, 0xC0,
+0x40, 0xA0, 0x38, 0x60, 0x30, 0x60, 0x28, 0x40, 0x20, 0x20, 0x8D, 0x00, 0x00, 0x00, 0x91, 0x81,
+0x81, 0xEA, 0xC2, 0x00, 0xBA, 0x41, 0x83, 0x00, 0x00, 0x07, 0x29, 0x65, 0xC6, 0x59, 0x94, 0xB2,
+0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x0B, 0x39, 0xE7,
+0xF7, 0xDF, 0xCE, 0x9A, 0xCE, 0x7A, 0x84, 0x51, 0xD6, 0xFC, 0xA5, 0x76, 0x00, 0x00, 0x20, 0x20,
+0x48, 0xC0, 0x48, 0xA0, 0x89, 0x60, 0x81, 0xEA, 0xC2, 0x02, 0xEA, 0xA2, 0x81, 0x40, 0x48, 0x80,
+0x85, 0x48, 0xA0, 0x82, 0x48, 0x80, 0x81, 0x40, 0x80, 0x03, 0x40, 0x60, 0x69, 0x00, 0xBA, 0x01,
+0xC2, 0x21, 0x82, 0xC2, 0x42, 0x00, 0xC2, 0x62, 0x82, 0xC2, 0x42, 0x02, 0xC2, 0x41, 0xB2, 0x01,
+0x48, 0xA0, 0x83, 0x48, 0x80, 0x87, 0x48, 0xA0, 0x01, 0x50, 0xA0, 0xBA, 0x21, 0x81, 0xEA, 0xC2,
+0x0C, 0xD2, 0x82, 0x50, 0xC0, 0x48, 0xA0, 0x40, 0xA0, 0x00, 0x00, 0x29, 0x65, 0xCE, 0x7A, 0x94,
+0xB2, 0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x0A, 0x39,
+0xC7, 0xF7, 0xBE, 0xCE, 0x9A, 0xC6, 0x7A, 0x84, 0x51, 0xDF, 0x1C, 0xAD, 0x96, 0x00, 0x00, 0x81,
+0x60, 0xEB, 0x03, 0xEA, 0xE2, 0x85, 0xEA, 0xC2, 0x86, 0xEA, 0xE3, 0x00, 0xEA, 0xC3, 0x81, 0xEA,
+0xE3, 0x81, 0xEA, 0xC3, 0x81, 0xEA, 0xC2, 0x00, 0xEA, 0xC3, 0x81, 0xEA, 0xE3, 0x03, 0xEA, 0xC2,
+0xEA, 0xE2, 0xEA, 0xC2, 0xEA, 0xE2, 0x89, 0xEA, 0xC2, 0x00, 0xEA, 0xC3, 0x84, 0xEA, 0xE3, 0x84,
+0xEA, 0xC2, 0x81, 0xEA, 0xE3, 0x09, 0xDA, 0xC3, 0x00, 0x00, 0x29, 0x65, 0xCE, 0x7A, 0x94, 0xB3,
+0x18, 0xE3, 0x31, 0x86, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x39, 0xC7,
+0xF7, 0xBE, 0x81, 0xCE, 0x9A, 0x05, 0x84, 0x51, 0xDE, 0xFC, 0xAD, 0x96, 0x00, 0x00, 0x81, 0x60,
+0xEB, 0x03, 0x85, 0xEA, 0xC2, 0x81, 0xEA, 0xE2, 0x04, 0xEA, 0xE3, 0xEA, 0xC2, 0xEA, 0xE2, 0xEA,
+0xC2, 0xEA, 0xE2, 0x86, 0xEA, 0xE3, 0x00, 0xEA, 0xC3, 0x82, 0xEA, 0xE3, 0x82, 0xEA, 0xC2, 0x00,
+0xEA, 0xE2, 0x8B, 0xEA, 0xC2, 0x81, 0xEA, 0xE2, 0x81, 0xEA, 0xE3, 0x00, 0xEA, 0xE2, 0x84, 0xEA,
+0xC2, 0x0A, 0xEA, 0xE2, 0xDA, 0xA2, 0x00, 0x00, 0x29, 0x65, 0xCE, 0x7A, 0x94, 0xB3, 0x18, 0xE3,
+0x31, 0x86, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x31, 0xA6, 0xDE, 0xFC,
+0x81, 0xCE, 0x9A, 0x05, 0x84, 0x51, 0xD6, 0xFC, 0xAD, 0x96, 0x00, 0x00, 0x81, 0x60, 0xEA, 0xE3,
+0x85, 0xEA, 0xC2, 0x82, 0xEA, 0xE2, 0x85, 0xEA, 0xC2, 0x00, 0xEA, 0xC3, 0x85, 0xEA, 0xE3, 0x82,
+0xEA, 0xE2, 0x83, 0xEA, 0xC2, 0x00, 0xEA, 0xC3, 0x8A, 0xEA, 0xC2, 0x81, 0xEA, 0xE2, 0x00, 0xEA,
+0xE3, 0x86, 0xEA, 0xC2, 0x09, 0xDA, 0xA2, 0x00, 0x00, 0x29, 0x65, 0xC6, 0x79, 0x94, 0xB3, 0x18,
+0xE3, 0x31, 0x86, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x09, 0x29, 0x86, 0xD6,
+0xDB, 0xCE, 0x9A, 0xCE, 0xBB, 0x84, 0x51, 0xD6, 0xFC, 0xAD, 0x96, 0x00, 0x00, 0x79, 0x40, 0xE2,
+0xC2, 0x83, 0xE2, 0xA2, 0x00, 0xE2, 0xC2, 0x82, 0xE2, 0xC3, 0x85, 0xE2, 0xC2, 0x82, 0xE2, 0xC3,
+0x00, 0xE2, 0xC2, 0x83, 0xE2, 0xC3, 0x86, 0xE2, 0xC2, 0x81, 0xE2, 0xC3, 0x8B, 0xE2, 0xC2, 0x00,
+0xE2, 0xC3, 0x81, 0xE2, 0xC2, 0x83, 0xE2, 0xA2, 0x0A, 0xE2, 0xC2, 0xD2, 0x82, 0x00, 0x00, 0x21,
+0x45, 0xC6, 0x59, 0x94, 0xB3, 0x18, 0xE3, 0x31, 0xA6, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8,
+0x00, 0x00, 0x06, 0x29, 0x65, 0xD6, 0xFB, 0xCE, 0x9A, 0xCE, 0xBB, 0x84, 0x51, 0xD6, 0xDB, 0xAD,
+0x96, 0xB7, 0x00, 0x00, 0x07, 0x21, 0x24, 0xBE, 0x18, 0x94, 0xD3, 0x21, 0x04, 0x31, 0xA6, 0xC6,
+0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x29, 0x65, 0xD6, 0xFB, 0x81, 0xCE, 0xBB,
+0x04, 0x84, 0x31, 0xD6, 0xBB, 0xAD, 0x76, 0x00, 0x00, 0x10, 0xA2, 0x83, 0x31, 0xA6, 0x00, 0x39,
+0xA6, 0x81, 0x31, 0xA6, 0x00, 0x31, 0x86, 0x83, 0x29, 0x65, 0x85, 0x29, 0x45, 0x81, 0x21, 0x24,
+0x02, 0x21, 0x04, 0x18, 0xE3, 0x18, 0xC3, 0x81, 0x10, 0xA2, 0x83, 0x10, 0x82, 0x86, 0x08, 0x61,
+0x82, 0x08, 0x41, 0x00, 0x00, 0x40, 0x83, 0x00, 0x20, 0x89, 0x00, 0x00, 0x07, 0x21, 0x24, 0xAD,
+0xB6, 0x94, 0xD3, 0x21, 0x04, 0x39, 0xC7, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00,
+0x01, 0x29, 0x65, 0xD6, 0xFB, 0x81, 0xCE, 0xBB, 0x04, 0x7C, 0x10, 0xCE, 0x9A, 0xAD, 0x96, 0x00,
+0x00, 0x8C, 0x92, 0x81, 0xE7, 0x5D, 0x82, 0xEF, 0x5D, 0x01, 0xE7, 0x5D, 0xE7, 0x3C, 0x81, 0xE7,
+0x1C, 0x00, 0xDF, 0x1C, 0x84, 0xDE, 0xFB, 0x82, 0xDE, 0xDB, 0x00, 0xD6, 0xBB, 0x81, 0xD6, 0xBA,
+0x28, 0xD6, 0x9A, 0xCE, 0x9A, 0xCE, 0x79, 0xCE, 0x59, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x18, 0xBE,
+0x18, 0xBD, 0xF7, 0xBD, 0xD7, 0xB5, 0xB7, 0xB5, 0xB6, 0xAD, 0x96, 0xAD, 0x75, 0xA5, 0x55, 0xA5,
+0x14, 0x9C, 0xF3, 0x94, 0xD3, 0x94, 0xB2, 0x8C, 0x71, 0x84, 0x51, 0x84, 0x10, 0x7B, 0xF0, 0x73,
+0xCF, 0x73, 0x8E, 0x6B, 0x4D, 0x5B, 0x0C, 0x5A, 0xCB, 0x52, 0xAA, 0x4A, 0x6A, 0x4A, 0x49, 0x3A,
+0x08, 0x00, 0x00, 0x29, 0x45, 0x9C, 0xF4, 0x94, 0xD3, 0x21, 0x04, 0x39, 0xC7, 0xC6, 0x38, 0xCE,
+0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x29, 0x65, 0xD6, 0xFB, 0x81, 0xCE, 0xBB, 0x07, 0x7B,
+0xF0, 0xCE, 0x9A, 0xAD, 0xB7, 0x00, 0x00, 0x4A, 0x69, 0x8C, 0x72, 0x7C, 0x30, 0x84, 0x30, 0x83,
+0x7C, 0x30, 0x85, 0x7C, 0x10, 0x84, 0x7C, 0x30, 0x84, 0x84, 0x30, 0x00, 0x7C, 0x30, 0x82, 0x84,
+0x30, 0x02, 0x7C, 0x30, 0x84, 0x30, 0x7C, 0x30, 0x82, 0x84, 0x30, 0x03, 0x84, 0x31, 0x84, 0x30,
+0x84, 0x31, 0x84, 0x30, 0x82, 0x84, 0x31, 0x82, 0x84, 0x30, 0x82, 0x84, 0x31, 0x81, 0x84, 0x51,
+0x81, 0x8C, 0x51, 0x81, 0x84, 0x51, 0x09, 0x73, 0xCF, 0x00, 0x00, 0x39, 0xE7, 0x8C, 0x92, 0x94,
+0xD3, 0x21, 0x04, 0x39, 0xC7, 0xC6, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x09, 0x29,
+0x45, 0xD6, 0xDB, 0xCE, 0xBB, 0xCE, 0x9A, 0x7B, 0xCF, 0xCE, 0x9A, 0xC6, 0x59, 0x21, 0x04, 0x00,
+0x20, 0x73, 0xAE, 0x82, 0x84, 0x51, 0x81, 0x84, 0x31, 0x84, 0x7C, 0x30, 0xA2, 0x84, 0x31, 0x81,
+0x84, 0x51, 0x81, 0x8C, 0x51, 0x0B, 0x84, 0x51, 0x84, 0x31, 0x4A, 0x69, 0x00, 0x00, 0x63, 0x4D,
+0x84, 0x31, 0x94, 0xB3, 0x21, 0x04, 0x39, 0xE7, 0xC6, 0x38, 0xD6, 0x9A, 0x18, 0xC3, 0xD8, 0x00,
+0x00, 0x04, 0x21, 0x45, 0xD6, 0xDB, 0xCE, 0x9B, 0xCE, 0x9A, 0x73, 0xCF, 0x81, 0xCE, 0x9A, 0x00,
+0x8C, 0x92, 0x81, 0x00, 0x00, 0x03, 0x29, 0x86, 0x39, 0xE7, 0x3A, 0x08, 0x39, 0xE8, 0x83, 0x39,
+0xE7, 0x85, 0x39, 0xE8, 0x87, 0x3A, 0x08, 0x81, 0x39, 0xE8, 0x82, 0x39, 0xE7, 0x82, 0x39, 0xC7,
+0x89, 0x31, 0xC7, 0x83, 0x31, 0xA7, 0x00, 0x31, 0xC7, 0x81, 0x39, 0xC7, 0x81, 0x39, 0xE7, 0x0B,
+0x31, 0xA7, 0x21, 0x04, 0x00, 0x00, 0x31, 0x86, 0x94, 0xB3, 0x7C, 0x10, 0x94, 0xD3, 0x18, 0xE4,
+0x39, 0xE7, 0xC6, 0x38, 0xD6, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x21, 0x24, 0xD6, 0xDB,
+0x81, 0xCE, 0x9A, 0x00, 0x73, 0xCF, 0x82, 0xCE, 0x9A, 0x02, 0x94, 0xD3, 0x31, 0xA6, 0x08, 0x61,
+0x86, 0x00, 0x20, 0x00, 0x00, 0x21, 0x88, 0x08, 0x41, 0x02, 0x00, 0x21, 0x00, 0x20, 0x00, 0x41,
+0x9B, 0x08, 0x41, 0x0B, 0x08, 0x61, 0x29, 0x65, 0x7B, 0xEF, 0xBE, 0x18, 0x84, 0x31, 0x7C, 0x10,
+0x94, 0xF4, 0x18, 0xE3, 0x39, 0xC7, 0xBE, 0x18, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01,
+0x21, 0x24, 0xCE, 0xBB, 0x81, 0xCE, 0x9A, 0x07, 0x6B, 0x6E, 0xCE, 0xBA, 0xCE, 0x9A, 0xCE, 0xBA,
+0xCE, 0xBB, 0xCE, 0xBA, 0xD6, 0xBB, 0xE7, 0x1C, 0x86, 0xE7, 0x3C, 0x81, 0xE7, 0x3D, 0x8A, 0xE7,
+0x5D, 0x84, 0xE7, 0x3D, 0x01, 0xE7, 0x5D, 0xE7, 0x3D, 0x8C, 0xE7, 0x5D, 0x85, 0xE7, 0x3C, 0x0C,
+0xEF, 0x5D, 0xE7, 0x1C, 0xD6, 0xDB, 0xD6, 0xBA, 0x94, 0xF3, 0x7C, 0x10, 0x84, 0x51, 0x94, 0xD3,
+0x18, 0xE4, 0x39, 0xC7, 0xBE, 0x18, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x21, 0x04,
+0xCE, 0xBB, 0x81, 0xCE, 0x9A, 0x02, 0x84, 0x30, 0xC6, 0x38, 0xCE, 0xBA, 0x81, 0xCE, 0x9A, 0x82,
+0xCE, 0xBA, 0x00, 0xD6, 0xBA, 0x81, 0xD6, 0xBB, 0xA5, 0xD6, 0xDB, 0x81, 0xD6, 0xFB, 0x81, 0xD6,
+0xDB, 0x81, 0xD6, 0xBB, 0x02, 0xD6, 0xBA, 0xC6, 0x39, 0x94, 0xB2, 0x81, 0x7C, 0x10, 0x06, 0x94,
+0xD3, 0x84, 0x30, 0x21, 0x45, 0x39, 0xE7, 0xBE, 0x38, 0xCE, 0x9A, 0x18, 0xC3, 0xD8, 0x00, 0x00,
+0x01, 0x21, 0x04, 0xCE, 0xBA, 0x81, 0xCE, 0x9A, 0x01, 0xBE, 0x39, 0x6B, 0x8E, 0x84, 0xCE, 0x9A,
+0x00, 0xC6, 0x9A, 0x83, 0xC6, 0x7A, 0x84, 0xCE, 0x7A, 0x81, 0xC6, 0x7A, 0x00, 0xCE, 0x7A, 0x82,
+0xC6, 0x7A, 0x90, 0xCE, 0x7A, 0x00, 0xC6, 0x7A, 0x89, 0xCE, 0x7A, 0x81, 0xC6, 0x59, 0x0D, 0xBE,
+0x18, 0xAD, 0x76, 0x94, 0xB3, 0x7C, 0x10, 0x7B, 0xF0, 0x7C, 0x10, 0x8C, 0x92, 0x94, 0xB3, 0x42,
+0x28, 0x39, 0xE7, 0x42, 0x29, 0xC6, 0x79, 0xCE, 0x9A, 0x10, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x21,
+0x04, 0xCE, 0xBB, 0x81, 0xCE, 0x9A, 0x03, 0xCE, 0xBA, 0xAD, 0xB6, 0x52, 0xAA, 0x73, 0xCF, 0x81,
+0x8C, 0x92, 0x00, 0x8C, 0x72, 0x83, 0x84, 0x71, 0x8E, 0x84, 0x51, 0x03, 0x84, 0x31, 0x7C, 0x31,
+0x7C, 0x30, 0x84, 0x31, 0x82, 0x84, 0x30, 0x82, 0x7C, 0x30, 0x00, 0x84, 0x30, 0x8B, 0x7C, 0x10,
+0x03, 0x7B, 0xF0, 0x73, 0xCF, 0x6B, 0x8E, 0x63, 0x6D, 0x82, 0x63, 0x4D, 0x0A, 0x63, 0x6D, 0x6B,
+0x6E, 0x6B, 0x8E, 0x63, 0x4D, 0x39, 0xC7, 0x39, 0xE7, 0x42, 0x28, 0x7C, 0x10, 0xCE, 0xBA, 0xC6,
+0x7A, 0x10, 0xC3, 0xD8, 0x00, 0x00, 0x08, 0x19, 0x04, 0xCE, 0xBB, 0xCE, 0xBA, 0xCE, 0x9A, 0xCE,
+0xBA, 0xCE, 0x9A, 0xC6, 0x59, 0x7C, 0x30, 0x19, 0x03, 0x81, 0x18, 0xC3, 0x81, 0x18, 0xE3, 0x00,
+0x19, 0x04, 0x90, 0x21, 0x04, 0x83, 0x18, 0xE3, 0x81, 0x21, 0x04, 0x00, 0x19, 0x03, 0x82, 0x18,
+0xE3, 0x00, 0x19, 0x04, 0x81, 0x21, 0x04, 0x00, 0x19, 0x04, 0x8B, 0x21, 0x04, 0x00, 0x19, 0x03,
+0x82, 0x18, 0xE3, 0x09, 0x21, 0x04, 0x29, 0x45, 0x31, 0xA7, 0x42, 0x28, 0x42, 0x08, 0x63, 0x2C,
+0xC6, 0x79, 0xCE, 0xBA, 0xC6, 0x9A, 0x10, 0xC3, 0xD8, 0x00, 0x00, 0x00, 0x19, 0x04, 0x81, 0xCE,
+0xBA, 0x83, 0xCE, 0x9A, 0x07, 0xC6, 0x79, 0x94, 0xF4, 0x6B, 0x8E, 0x52, 0xAB, 0x4A, 0x8A, 0x52,
+0x8A, 0x4A, 0x8A, 0x4A, 0x69, 0x81, 0x4A, 0x8A, 0x85, 0x4A, 0x69, 0x82, 0x4A, 0x49, 0x81, 0x4A,
+0x69, 0x00, 0x4A, 0x49, 0x81, 0x42, 0x29, 0x81, 0x42, 0x49, 0x82, 0x42, 0x28, 0x03, 0x42, 0x49,
+0x4A, 0x49, 0x42, 0x49, 0x42, 0x28, 0x81, 0x42, 0x08, 0x02, 0x42, 0x28, 0x42, 0x49, 0x4A, 0x49,
+0x83, 0x42, 0x28, 0x81, 0x42, 0x49, 0x81, 0x42, 0x28, 0x01, 0x42, 0x49, 0x4A, 0x49, 0x81, 0x4A,
+0x69, 0x00, 0x4A, 0x49, 0x82, 0x42, 0x49, 0x05, 0x4A, 0x49, 0x4A, 0x69, 0x4A, 0x8A, 0x63, 0x2C,
+0x94, 0xF3, 0xCE, 0x9A, 0x81, 0xCE, 0xBA, 0x01, 0xCE, 0x9A, 0x10, 0xC3, 0xD8, 0x00, 0x00, 0x01,
+0x19, 0x04, 0xCE, 0xBA, 0x87, 0xCE, 0x9A, 0x81, 0xCE, 0xBA, 0x84, 0xCE, 0x9A, 0x81, 0xC6, 0x9A,
+0x00, 0xCE, 0x9A, 0x86, 0xC6, 0x7A, 0x81, 0xCE, 0x7A, 0x07, 0xC6, 0x5A, 0xC6, 0x79, 0xC6, 0x7A,
+0xCE, 0x7A, 0xC6, 0x7A, 0xC6, 0x79, 0xC6, 0x59, 0xC6, 0x7A, 0x81, 0xCE, 0x9A, 0x81, 0xC6, 0x7A,
+0x04, 0xC6, 0x79, 0xC6, 0x7A, 0xCE, 0x9A, 0xCE, 0x7A, 0xC6, 0x7A, 0x81, 0xC6, 0x59, 0x02, 0xC6,
+0x7A, 0xCE, 0x9A, 0xC6, 0x7A, 0x81, 0xC6, 0x79, 0x00, 0xC6, 0x7A, 0x82, 0xCE, 0x9A, 0x85, 0xC6,
+0x7A, 0x82, 0xCE, 0x9A, 0x83, 0xCE, 0xBA, 0x00, 0x18, 0xC3, 0xD8, 0x00, 0x00, 0x01, 0x19, 0x04,
+0xCE, 0xBA, 0x82, 0xCE, 0x9A, 0x05, 0xC6, 0x9A, 0xC6, 0x7A, 0x9D, 0x34, 0x94, 0xD3, 0xC6, 0x59,
+0xCE, 0xBA, 0x83, 0xCE, 0x9A, 0x03, 0xBE, 0x38, 0x9D, 0x14, 0xB5, 0xF7, 0xCE, 0xBA, 0x8A, 0xCE,
+0x9A, 0x03, 0xC6, 0x59, 0xBE, 0x39, 0xC6, 0x59, 0xC6, 0x7A, 0x83, 0xCE, 0x9A, 0x81, 0xC6, 0x59,
+0x01, 0xC6, 0x39, 0xBE, 0x39, 0x81, 0xC6, 0x59, 0x85, 0xCE, 0x9A, 0x82, 0xC6, 0x7A, 0x85, 0xCE,
+0x9A, 0x81, 0xCE, 0xBA, 0x85, 0xCE, 0x9A, 0x81, 0xCE, 0xBA, 0x01, 0xCE, 0x9A, 0x18, 0xC3, 0xD8,
+0x00, 0x00, 0x00, 0x18, 0xC3, 0x83, 0xCE, 0x9A, 0x04, 0xC6, 0x7A, 0x8C, 0x92, 0x9A, 0xC4, 0xB3,
+0x25, 0x52, 0x8A, 0x83, 0xCE, 0x9A, 0x04, 0xBE, 0x18, 0x52, 0xCB, 0x94, 0xF3, 0x5A, 0xEB, 0xAD,
+0x96, 0x89, 0xCE, 0x9A, 0x01, 0xAD, 0x96, 0x18, 0xE3, 0x81, 0x08, 0x61, 0x04, 0x18, 0xC3, 0xB5,
+0xF7, 0xCE, 0xBA, 0xCE, 0x9A, 0x94, 0xD3, 0x81, 0x08, 0x61, 0x00, 0x10, 0x82, 0x81, 0x08, 0x61,
+0x01, 0x10, 0xA2, 0xAD, 0x76, 0x82, 0xCE, 0x9A, 0x07, 0xBE, 0x38, 0x5A, 0xEB, 0x31, 0xA6, 0x39,
+0xC7, 0x31, 0x86, 0x52, 0xCB, 0x9C, 0xF4, 0xC6, 0x7A, 0x82, 0xCE, 0x9A, 0x04, 0xB5, 0xD7, 0x52,
+0xCB, 0x4A, 0x49, 0x5A, 0xEB, 0xB6, 0x18, 0x83, 0xCE, 0x9A, 0x02, 0xCE, 0xBA, 0xCE, 0x9A, 0x10,
+0xC3, 0xD9, 0x00, 0x00, 0x00, 0xBE, 0x18, 0x81, 0xCE, 0x9A, 0x81, 0xC6, 0x9A, 0x04, 0x63, 0x4D,
+0xDC, 0x27, 0xEC, 0x68, 0x49, 0x21, 0xC6, 0x59, 0x81, 0xCE, 0x9A, 0x05, 0xC6, 0x9A, 0x9D, 0x34,
+0x94, 0xD3, 0xC6, 0x79, 0xA5, 0x35, 0x8C, 0x72, 0x88, 0xCE, 0x9A, 0x06, 0xC6, 0x9A, 0x84, 0x31,
+0x00, 0x00, 0x00, 0x20, 0x10, 0xC3, 0x08, 0x40, 0x9C, 0xF4, 0x81, 0xCE, 0x9A, 0x07, 0x8C, 0x72,
+0x39, 0xE7, 0x42, 0x08, 0x10, 0x81, 0x21, 0x24, 0x29, 0x44, 0x00, 0x00, 0x94, 0xF3, 0x82, 0xCE,
+0x9A, 0x07, 0x94, 0xF3, 0x29, 0x65, 0x4A, 0x69, 0x39, 0xE7, 0x4A, 0x49, 0x42, 0x08, 0x21, 0x24,
+0xC6, 0x79, 0x81, 0xCE, 0x9A, 0x05, 0xCE, 0xBA, 0x5A, 0xEB, 0x18, 0x40, 0x18, 0x20, 0x08, 0x00,
+0x8C, 0x72, 0x84, 0xCE, 0x9A, 0x01, 0xBE, 0x38, 0x00, 0x20, 0xD9, 0x00, 0x00, 0x00, 0x7B, 0xF0,
+0x83, 0xCE, 0x9A, 0x04, 0xA5, 0x55, 0x61, 0xC2, 0x7A, 0x23, 0x6B, 0xAE, 0xC6, 0x7A, 0x82, 0xCE,
+0x9A, 0x04, 0xBE, 0x39, 0x52, 0xAA, 0x94, 0xB2, 0x52, 0xAB, 0xAD, 0xB6, 0x88, 0xCE, 0x9A, 0x01,
+0xBE, 0x18, 0x4A, 0x8A, 0x83, 0x00, 0x00, 0x00, 0xAD, 0xB6, 0x81, 0xCE, 0x9A, 0x00, 0x8C, 0x72,
+0x85, 0x00, 0x00, 0x00, 0xAD, 0x96, 0x82, 0xCE, 0x9A, 0x02, 0xBE, 0x18, 0x42, 0x28, 0x00, 0x20,
+0x82, 0x00, 0x00, 0x02, 0x7B, 0xF0, 0xC6, 0x7A, 0xC6, 0x9A, 0x81, 0xCE, 0x9A, 0x04, 0x8C, 0x92,
+0x31, 0x86, 0x31, 0xA6, 0x42, 0x49, 0xB5, 0xD7, 0x84, 0xCE, 0x9A, 0x00, 0x84, 0x71, 0xDB, 0x00,
+0x00, 0x01, 0x6B, 0x8E, 0xBE, 0x18, 0x81, 0xCE, 0x9A, 0x03, 0xCE, 0xBA, 0xBD, 0xF8, 0xAD, 0x96,
+0xC6, 0x7A, 0x84, 0xCE, 0x9A, 0x03, 0xBE, 0x18, 0x9D, 0x14, 0xB5, 0xF7, 0xC6, 0x9A, 0x88, 0xCE,
+0x9A, 0x05, 0xB5, 0xD7, 0xAD, 0xB7, 0xB5, 0xD7, 0xB5, 0xF8, 0xBD, 0xF8, 0xBE, 0x18, 0x81, 0xC6,
+0x9A, 0x81, 0xCE, 0x9A, 0x84, 0xBE, 0x18, 0x00, 0xC6, 0x59, 0x85, 0xCE, 0x9A, 0x00, 0xC6, 0x59,
+0x81, 0xB5, 0xD7, 0x00, 0xBE, 0x39, 0x8C, 0xCE, 0x9A, 0x01, 0xAD, 0xB6, 0x6B, 0x8E, 0xDD, 0x00,
+0x00, 0x00, 0x94, 0xB3, 0x8A, 0xCE, 0x9A, 0x81, 0xC6, 0x9A, 0x8C, 0xCE, 0x9A, 0x00, 0xC6, 0x7A,
+0x88, 0xCE, 0x9A, 0x81, 0xC6, 0x7A, 0x01, 0xCE, 0x9A, 0xCE, 0xBA, 0x96, 0xCE, 0x9A, 0x00, 0x7B,
+0xF0, 0xDE, 0x00, 0x00, 0x00, 0x8C, 0xB2, 0x94, 0xCE, 0x9A, 0x01, 0xC6, 0x7A, 0xB5, 0xD7, 0x86,
+0x84, 0x51, 0x01, 0x8C, 0x71, 0x84, 0x51, 0x81, 0x8C, 0x51, 0x83, 0x84, 0x51, 0x02, 0x8C, 0x72,
+0x8C, 0x92, 0xBE, 0x38, 0x95, 0xCE, 0x9A, 0x00, 0x7B, 0xF0, 0xDE, 0x00, 0x00, 0x01, 0x8C, 0x92,
+0xC6, 0x9A, 0x93, 0xCE, 0x9A, 0x01, 0xBE, 0x38, 0x31, 0xA6, 0x90, 0x00, 0x00, 0x01, 0x52, 0xAB,
+0xC6, 0x7A, 0x87, 0xCE, 0x9A, 0x00, 0xCE, 0x7A, 0x87, 0xCE, 0x9A, 0x00, 0xCE, 0xBA, 0x82, 0xCE,
+0x9A, 0x00, 0x7B, 0xF0, 0xDE, 0x00, 0x00, 0x02, 0x39, 0xE7, 0x5A, 0xEC, 0x5B, 0x0C, 0x83, 0x63,
+0x2C, 0x00, 0x5B, 0x0C, 0x81, 0x63, 0x0C, 0x88, 0x63, 0x2C, 0x81, 0x63, 0x0C, 0x01, 0x5B, 0x0C,
+0x39, 0xC7, 0x92, 0x00, 0x00, 0x01, 0x39, 0xE8, 0x5A, 0xEC, 0x89, 0x5B, 0x0C, 0x00, 0x63, 0x0C,
+0x83, 0x5B, 0x0C, 0x00, 0x63, 0x0C, 0x81, 0x5B, 0x0C, 0x02, 0x5A, 0xEB, 0x52, 0xCB, 0x29, 0x66,
+0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x82, 0x00, 0x00, 0x01, 0x08, 0x41, 0x84, 0x71, 0x81, 0x84,
+0x51, 0x01, 0x7C, 0x51, 0x7C, 0x31, 0x81, 0x42, 0x49, 0x00, 0x39, 0xE7, 0xA6, 0x00, 0x00, 0x81,
+0x84, 0x72, 0x82, 0x84, 0x51, 0x81, 0x4A, 0x6A, 0x00, 0x3A, 0x08, 0xE7, 0x00, 0x00, 0x00, 0x08,
+0x61, 0x83, 0x94, 0xD3, 0x00, 0x8C, 0xB2, 0x81, 0x4A, 0x6A, 0x00, 0x39, 0xE8, 0xA6, 0x00, 0x00,
+0x00, 0x94, 0xB3, 0x81, 0x94, 0xF3, 0x04, 0x94, 0xF4, 0x94, 0xD3, 0x52, 0xAB, 0x4A, 0xAB, 0x42,
+0x49, 0xE7, 0x00, 0x00, 0x08, 0x08, 0x41, 0x94, 0xB3, 0x94, 0xD3, 0x94, 0xF3, 0x94, 0xD3, 0x8C,
+0xB2, 0x4A, 0x6A, 0x42, 0x49, 0x31, 0xA7, 0xA6, 0x00, 0x00, 0x04, 0x8C, 0x72, 0x94, 0xF3, 0x94,
+0xF4, 0x94, 0xF3, 0x8C, 0xB3, 0x81, 0x4A, 0xAA, 0x00, 0x3A, 0x29, 0xE7, 0x00, 0x00, 0x00, 0x08,
+0x41, 0x82, 0x94, 0xD3, 0x04, 0x94, 0xF3, 0x8C, 0x92, 0x4A, 0x6A, 0x42, 0x49, 0x29, 0x66, 0xA6,
+0x00, 0x00, 0x00, 0x84, 0x51, 0x81, 0x94, 0xF4, 0x01, 0x94, 0xF3, 0x8C, 0xB2, 0x81, 0x4A, 0xAA,
+0x00, 0x42, 0x29, 0xE7, 0x00, 0x00, 0x00, 0x08, 0x41, 0x81, 0x94, 0xF3, 0x81, 0x94, 0xD3, 0x03,
+0x84, 0x72, 0x4A, 0x8A, 0x4A, 0x6A, 0x21, 0x45, 0xA6, 0x00, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0x94,
+0xF3, 0x04, 0x94, 0xF4, 0x8C, 0xB3, 0x4A, 0xAA, 0x4A, 0x8A, 0x42, 0x49, 0xE8, 0x00, 0x00, 0x01,
+0x21, 0x45, 0x21, 0x25, 0x81, 0x21, 0x24, 0x00, 0x19, 0x04, 0x81, 0x10, 0x82, 0xA7, 0x00, 0x00,
+0x00, 0x10, 0xC3, 0x82, 0x21, 0x24, 0x03, 0x21, 0x04, 0x08, 0x62, 0x08, 0x61, 0x08, 0x41, 0xFF,
+0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xE2, 0x00,
+0x00, 0x03, 0x10, 0xA2, 0x42, 0x28, 0x3A, 0x08, 0x08, 0x82, 0xA5, 0x00, 0x00, 0x03, 0x08, 0x61,
+0x39, 0xE8, 0x3A, 0x08, 0x08, 0x82, 0x98, 0x00, 0x00, 0x03, 0x29, 0x65, 0x4A, 0x8A, 0x42, 0x49,
+0x10, 0xA2, 0xB9, 0x00, 0x00, 0x04, 0x08, 0x61, 0xCE, 0x7A, 0xD6, 0xDB, 0xDE, 0xFB, 0x73, 0xAF,
+0x83, 0x00, 0x00, 0x00, 0x84, 0x51, 0x81, 0xD6, 0xBB, 0x00, 0xBD, 0xF7, 0x83, 0x00, 0x00, 0x03,
+0x63, 0x0C, 0xD6, 0xDB, 0xD6, 0xBA, 0xB5, 0xD7, 0x83, 0x00, 0x00, 0x07, 0x6B, 0x8E, 0xBE, 0x38,
+0xDE, 0xFC, 0xDF, 0x1C, 0xDE, 0xFC, 0xD6, 0xDB, 0xBD, 0xF8, 0x73, 0xAE, 0x84, 0x00, 0x00, 0x09,
+0x7B, 0xEF, 0xCE, 0x9A, 0xCE, 0xBA, 0xD6, 0xBB, 0xD6, 0xDB, 0xD6, 0xBB, 0xCE, 0x9A, 0xC6, 0x59,
+0xAD, 0x96, 0x63, 0x2C, 0x83, 0x00, 0x00, 0x00, 0xA5, 0x14, 0x81, 0xD6, 0xBB, 0x00, 0x9C, 0xD3,
+0x83, 0x00, 0x00, 0x04, 0xA5, 0x34, 0xD6, 0xDB, 0xDE, 0xDB, 0xCE, 0x59, 0x29, 0x45, 0x81, 0x00,
+0x00, 0x02, 0x4A, 0x8A, 0xB5, 0xB7, 0xD6, 0xDB, 0x81, 0xDF, 0x1C, 0x03, 0xDE, 0xFC, 0xC6, 0x18,
+0x8C, 0x51, 0x21, 0x25, 0x81, 0x00, 0x00, 0x00, 0x94, 0x92, 0x81, 0xD6, 0xBB, 0x00, 0x94, 0xB2,
+0x84, 0x00, 0x00, 0x03, 0xAD, 0x96, 0xD6, 0xBA, 0xD6, 0xDB, 0x7B, 0xEF, 0x83, 0x00, 0x00, 0x02,
+0x08, 0x41, 0x8C, 0x51, 0xCE, 0x79, 0x81, 0xE7, 0x3C, 0x03, 0xE7, 0x1C, 0xDE, 0xFB, 0xB5, 0xB7,
+0x5A, 0xEC, 0x84, 0x00, 0x00, 0x00, 0xBE, 0x18, 0x81, 0xD6, 0xBB, 0x06, 0xD6, 0xDB, 0xDE, 0xFC,
+0xDE, 0xFB, 0xD6, 0xDB, 0xC6, 0x39, 0x94, 0xD3, 0x29, 0x65, 0xA9, 0x00, 0x00, 0x00, 0xAD, 0x75,
+0x81, 0xE7, 0x1C, 0x00, 0xAD, 0x76, 0x83, 0x00, 0x00, 0x04, 0xBE, 0x18, 0xE7, 0x1C, 0xDF, 0x1C,
+0xDE, 0xFC, 0x18, 0xE3, 0x82, 0x00, 0x00, 0x00, 0x9C, 0xD3, 0x81, 0xDF, 0x1C, 0x00, 0x9C, 0xF4,
+0x82, 0x00, 0x00, 0x00, 0xA5, 0x55, 0x87, 0xDF, 0x1C, 0x01, 0xB5, 0xD7, 0x21, 0x24, 0x82, 0x00,
+0x00, 0x00, 0x7C, 0x10, 0x82, 0xDE, 0xFC, 0x00, 0xDF, 0x1C, 0x82, 0xDE, 0xFC, 0x81, 0xDF, 0x1C,
+0x00, 0x94, 0x92, 0x82, 0x00, 0x00, 0x03, 0xA5, 0x55, 0xDE, 0xFC, 0xDE, 0xFB, 0x9C, 0xF3, 0x82,
+0x00, 0x00, 0x04, 0x94, 0x92, 0xDF, 0x1C, 0xE7, 0x1C, 0xDE, 0xFB, 0x5A, 0xCB, 0x81, 0x00, 0x00,
+0x01, 0x63, 0x0C, 0xDE, 0xFC, 0x82, 0xDF, 0x1C, 0x81, 0xE7, 0x1C, 0x81, 0xDF, 0x1C, 0x00, 0xC6,
+0x59, 0x81, 0x00, 0x00, 0x00, 0x94, 0xB3, 0x81, 0xDF, 0x1C, 0x00, 0x9C, 0xF3, 0x84, 0x00, 0x00,
+0x03, 0xB5, 0xD7, 0xDE, 0xFC, 0xDF, 0x1C, 0x84, 0x10, 0x82, 0x00, 0x00, 0x01, 0x31, 0xA6, 0xBE,
+0x18, 0x86, 0xE7, 0x1C, 0x01, 0xDF, 0x1C, 0x9C, 0xF3, 0x83, 0x00, 0x00, 0x01, 0xC6, 0x38, 0xDE,
+0xFC, 0x85, 0xDF, 0x1C, 0x02, 0xDE, 0xFB, 0xCE, 0x7A, 0x39, 0xC7, 0xA8, 0x00, 0x00, 0x03, 0x6B,
+0x6D, 0xE7, 0x1C, 0xDF, 0x1C, 0xD6, 0xBA, 0x82, 0x00, 0x00, 0x01, 0x18, 0xC3, 0xD6, 0xFB, 0x82,
+0xDF, 0x1C, 0x00, 0x6B, 0x6D, 0x82, 0x00, 0x00, 0x03, 0xBD, 0xF8, 0xDF, 0x1C, 0xE7, 0x1C, 0x5B,
+0x0C, 0x81, 0x00, 0x00, 0x00, 0x9C, 0xF3, 0x82, 0xDF, 0x1C, 0x03, 0xD6, 0xDB, 0xB5, 0xB7, 0xAD,
+0x96, 0xCE, 0x7A, 0x82, 0xDF, 0x1C, 0x01, 0xBE, 0x18, 0x08, 0x61, 0x81, 0x00, 0x00, 0x00, 0x84,
+0x30, 0x81, 0xDE, 0xFC, 0x00, 0xCE, 0x59, 0x81, 0x9C, 0xF3, 0x01, 0x9C, 0xF4, 0xB5, 0xB7, 0x82,
+0xDF, 0x1C, 0x00, 0x5A, 0xCB, 0x81, 0x00, 0x00, 0x03, 0xA5, 0x55, 0xDF, 0x1C, 0xDE, 0xFC, 0x9C,
+0xF3, 0x81, 0x00, 0x00, 0x04, 0x7B, 0xEF, 0xDF, 0x1C, 0xE7, 0x1C, 0xDE, 0xFB, 0x6B, 0x6D, 0x82,
+0x00, 0x00, 0x00, 0xC6, 0x59, 0x81, 0xDF, 0x1C, 0x06, 0xCE, 0x79, 0x8C, 0x72, 0x94, 0x92, 0xB5,
+0xB6, 0xD6, 0xBB, 0xDF, 0x1C, 0xA5, 0x35, 0x81, 0x00, 0x00, 0x00, 0x94, 0xB3, 0x81, 0xDF, 0x1C,
+0x00, 0x9C, 0xF3, 0x84, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x81, 0xDE, 0xFC, 0x00, 0x84, 0x10, 0x81,
+0x00, 0x00, 0x01, 0x10, 0xA2, 0xC6, 0x59, 0x82, 0xE7, 0x1C, 0x03, 0xCE, 0x79, 0xAD, 0x96, 0xB5,
+0xB6, 0xD6, 0xBB, 0x82, 0xE7, 0x1C, 0x00, 0x94, 0xD2, 0x82, 0x00, 0x00, 0x00, 0xC6, 0x39, 0x81,
+0xDF, 0x1C, 0x00, 0xAD, 0x96, 0x81, 0x9C, 0xF3, 0x04, 0xAD, 0x55, 0xD6, 0xBA, 0xDF, 0x1C, 0xE7,
+0x1C, 0xB5, 0xB6, 0xA8, 0x00, 0x00, 0x01, 0x08, 0x41, 0xD6, 0xBA, 0x81, 0xDF, 0x1C, 0x00, 0x52,
+0xAA, 0x81, 0x00, 0x00, 0x01, 0x6B, 0x8E, 0xE7, 0x1C, 0x82, 0xDF, 0x1C, 0x00, 0xA5, 0x34, 0x81,
+0x00, 0x00, 0x06, 0x10, 0x82, 0xD6, 0xDB, 0xDF, 0x1C, 0xD6, 0xBA, 0x08, 0x41, 0x00, 0x00, 0x4A,
+0x69, 0x82, 0xDF, 0x1C, 0x01, 0xB5, 0xB6, 0x21, 0x24, 0x81, 0x00, 0x00, 0x05, 0x08, 0x41, 0x8C,
+0x71, 0xDE, 0xFC, 0xDF, 0x1C, 0xDE, 0xFC, 0x94, 0xB2, 0x81, 0x00, 0x00, 0x03, 0x84, 0x30, 0xDF,
+0x1C, 0xDE, 0xFC, 0xB5, 0xB7, 0x83, 0x00, 0x00, 0x00, 0x94, 0x92, 0x81, 0xDF, 0x1C, 0x00, 0xA5,
+0x34, 0x81, 0x00, 0x00, 0x06, 0xA5, 0x55, 0xDF, 0x1C, 0xDE, 0xFC, 0x9C, 0xF3, 0x00, 0x00, 0x63,
+0x2C, 0xDE, 0xFB, 0x81, 0xDF, 0x1C, 0x00, 0x7B, 0xCF, 0x82, 0x00, 0x00, 0x01, 0x21, 0x04, 0xE7,
+0x1C, 0x81, 0xDF, 0x1C, 0x00, 0x73, 0xAE, 0x82, 0x00, 0x00, 0x02, 0x18, 0xE3, 0x8C, 0x51, 0x52,
+0xAA, 0x81, 0x00, 0x00, 0x00, 0x94, 0xD3, 0x81, 0xDF, 0x1C, 0x00, 0x9C, 0xF3, 0x84, 0x00, 0x00,
+0x00, 0xB5, 0xD7, 0x81, 0xDE, 0xFC, 0x00, 0x84, 0x30, 0x81, 0x00, 0x00, 0x00, 0x94, 0xD3, 0x81,
+0xE7, 0x1C, 0x01, 0xDF, 0x1C, 0x84, 0x30, 0x82, 0x00, 0x00, 0x01, 0x21, 0x04, 0xAD, 0x96, 0x81,
+0xE7, 0x1C, 0x01, 0xDE, 0xFB, 0x4A, 0x49, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x59, 0x81, 0xDF, 0x1C,
+0x00, 0x6B, 0x6E, 0x82, 0x00, 0x00, 0x04, 0x4A, 0x49, 0xDE, 0xFB, 0xE7, 0x1C, 0xDE, 0xFB, 0x10,
+0xA2, 0xA8, 0x00, 0x00, 0x03, 0xA5, 0x55, 0xDE, 0xFC, 0xDF, 0x1C, 0x94, 0xD3, 0x81, 0x00, 0x00,
+0x05, 0xA5, 0x55, 0xE7, 0x1C, 0xC6, 0x59, 0xCE, 0x59, 0xDF, 0x1C, 0xCE, 0x79, 0x81, 0x00, 0x00,
+0x00, 0x63, 0x0C, 0x81, 0xDF, 0x1C, 0x00, 0xAD, 0x75, 0x81, 0x00, 0x00, 0x00, 0xA5, 0x55, 0x81,
+0xDF, 0x1C, 0x01, 0xCE, 0x59, 0x08, 0x61, 0x84, 0x00, 0x00, 0x00, 0xAD, 0x55, 0x81, 0xDF, 0x1C,
+0x03, 0xD6, 0xBA, 0x08, 0x61, 0x00, 0x00, 0x84, 0x30, 0x81, 0xDE, 0xFC, 0x00, 0xB5, 0xD7, 0x83,
+0x00, 0x00, 0x00, 0x31, 0xA6, 0x81, 0xDF, 0x1C, 0x00, 0xB5, 0xD7, 0x81, 0x00, 0x00, 0x00, 0xA5,
+0x35, 0x81, 0xDF, 0x1C, 0x05, 0x9C, 0xF3, 0x52, 0xAA, 0xD6, 0xDB, 0xE7, 0x1C, 0xDF, 0x1C, 0x8C,
+0x51, 0x83, 0x00, 0x00, 0x05, 0x10, 0xA2, 0xDE, 0xFB, 0xDF, 0x1C, 0xE7, 0x1C, 0xC6, 0x18, 0x4A,
+0x49, 0x86, 0x00, 0x00, 0x03, 0x9C, 0xF3, 0xE7, 0x1C, 0xDF, 0x1C, 0x94, 0xD3, 0x84, 0x00, 0x00,
+0x00, 0xBD, 0xD7, 0x81, 0xDE, 0xFC, 0x03, 0x84, 0x10, 0x00, 0x00, 0x00, 0x20, 0xD6, 0x9A, 0x81,
+0xE7, 0x1C, 0x00, 0xA5, 0x14, 0x84, 0x00, 0x00, 0x04, 0x08, 0x61, 0xC6, 0x59, 0xE7, 0x1C, 0xDF,
+0x1C, 0xA5, 0x34, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x59, 0x81, 0xDF, 0x1C, 0x00, 0x6B, 0x8E, 0x83,
+0x00, 0x00, 0x00, 0xC6, 0x38, 0x81, 0xE7, 0x1C, 0x00, 0x31, 0xA6, 0xA8, 0x00, 0x00, 0x03, 0x6B,
+0x4D, 0xDF, 0x1C, 0xE7, 0x3C, 0xC6, 0x38, 0x81, 0x00, 0x00, 0x01, 0xC6, 0x59, 0xDF, 0x1C, 0x81,
+0xA5, 0x34, 0x81, 0xDF, 0x1C, 0x02, 0x39, 0xE7, 0x00, 0x00, 0x9C, 0xF3, 0x81, 0xDF, 0x1C, 0x00,
+0x73, 0xAE, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x81, 0xDF, 0x1C, 0x00, 0x94, 0x92, 0x85, 0x00,
+0x00, 0x00, 0x4A, 0x8A, 0x82, 0xDF, 0x1C, 0x02, 0x4A, 0x8A, 0x00, 0x00, 0x7C, 0x10, 0x81, 0xDE,
+0xFC, 0x00, 0xB5, 0xD7, 0x83, 0x00, 0x00, 0x00, 0x52, 0xCB, 0x81, 0xDF, 0x1C, 0x00, 0xB5, 0xB7,
+0x81, 0x00, 0x00, 0x00, 0xA5, 0x35, 0x81, 0xDF, 0x1C, 0x01, 0xAD, 0x96, 0xD6, 0xBA, 0x81, 0xDF,
+0x1C, 0x00, 0xAD, 0x75, 0x85, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0x83, 0xE7, 0x1C, 0x02, 0xC6, 0x39,
+0x9C, 0xD3, 0x4A, 0x69, 0x83, 0x00, 0x00, 0x09, 0x9C, 0xF3, 0xE7, 0x1C, 0xDF, 0x1C, 0xC6, 0x59,
+0xAD, 0x96, 0xAD, 0x76, 0xAD, 0x96, 0xAD, 0xB6, 0xB5, 0xB6, 0xD6, 0xBA, 0x81, 0xDE, 0xFC, 0x02,
+0x7C, 0x10, 0x00, 0x00, 0x39, 0xE7, 0x82, 0xE7, 0x1C, 0x00, 0x42, 0x28, 0x85, 0x00, 0x00, 0x03,
+0x94, 0x92, 0xDF, 0x1C, 0xE7, 0x1C, 0xC6, 0x38, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x39, 0x81, 0xDF,
+0x1C, 0x00, 0x73, 0x8E, 0x83, 0x00, 0x00, 0x03, 0xCE, 0x79, 0xE7, 0x1C, 0xE7, 0x3C, 0x31, 0x86,
+0xA8, 0x00, 0x00, 0x07, 0x08, 0x61, 0xD6, 0xDB, 0xE7, 0x3C, 0xDE, 0xFB, 0x21, 0x04, 0x31, 0xC7,
+0xDF, 0x1C, 0xE7, 0x1C, 0x81, 0x6B, 0x8E, 0x81, 0xE7, 0x1C, 0x05, 0x84, 0x30, 0x00, 0x00, 0xBE,
+0x18, 0xDF, 0x1C, 0xD6, 0xDB, 0x18, 0xC3, 0x81, 0x00, 0x00, 0x03, 0xCE, 0x9A, 0xDF, 0x1C, 0xE7,
+0x1C, 0x7B, 0xCF, 0x85, 0x00, 0x00, 0x01, 0x19, 0x04, 0xDE, 0xFC, 0x81, 0xDF, 0x1C, 0x02, 0x63,
+0x0C, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xDE, 0xFC, 0x00, 0xBD, 0xD7, 0x82, 0x08, 0x41, 0x01, 0x3A,
+0x08, 0xBD, 0xF8, 0x81, 0xDF, 0x1C, 0x00, 0x94, 0xB2, 0x81, 0x00, 0x00, 0x00, 0xA5, 0x34, 0x81,
+0xDF, 0x1C, 0x81, 0xDE, 0xFC, 0x81, 0xDF, 0x1C, 0x01, 0xD6, 0xDB, 0x39, 0xE7, 0x84, 0x00, 0x00,
+0x03, 0x29, 0x65, 0xC6, 0x18, 0xE7, 0x3C, 0xE7, 0x1C, 0x81, 0xDF, 0x1C, 0x81, 0xDE, 0xFC, 0x01,
+0xB5, 0xD7, 0x31, 0x86, 0x81, 0x00, 0x00, 0x01, 0x9C, 0xF3, 0xE7, 0x1C, 0x81, 0xDF, 0x1C, 0x81,
+0xDE, 0xFC, 0x01, 0xDE, 0xFB, 0xDE, 0xFC, 0x82, 0xDF, 0x1C, 0x03, 0xDE, 0xFC, 0x7C, 0x10, 0x00,
+0x00, 0x52, 0xAA, 0x81, 0xE7, 0x1C, 0x01, 0xDE, 0xFB, 0x10, 0xA2, 0x85, 0x00, 0x00, 0x03, 0x73,
+0xCF, 0xE7, 0x3C, 0xE7, 0x1C, 0xD6, 0xBA, 0x81, 0x00, 0x00, 0x0B, 0xC6, 0x38, 0xDE, 0xFC, 0xDF,
+0x1C, 0x73, 0xAF, 0x10, 0xC3, 0x10, 0xA3, 0x31, 0xA6, 0x9C, 0xF3, 0xDF, 0x1C, 0xE7, 0x1C, 0xD6,
+0x9A, 0x00, 0x40, 0xA9, 0x00, 0x00, 0x0F, 0xAD, 0x96, 0xE7, 0x3C, 0xDF, 0x1C, 0x6B, 0x6E, 0x7B,
+0xF0, 0xDF, 0x1C, 0xDE, 0xFC, 0x21, 0x04, 0x18, 0xE3, 0xDE, 0xFC, 0xDF, 0x1C, 0xB5, 0x96, 0x10,
+0xC3, 0xDE, 0xFB, 0xDF, 0x1C, 0xB5, 0xD7, 0x82, 0x00, 0x00, 0x03, 0xC6, 0x59, 0xDE, 0xFC, 0xDF,
+0x1C, 0x8C, 0x51, 0x85, 0x00, 0x00, 0x00, 0x29, 0x86, 0x82, 0xDF, 0x1C, 0x02, 0x52, 0xAA, 0x00,
+0x00, 0x7B, 0xEF, 0x82, 0xDE, 0xFC, 0x00, 0xD6, 0xFB, 0x81, 0xD6, 0xDB, 0x04, 0xDE, 0xFC, 0xDF,
+0x1C, 0xE7, 0x3C, 0xD6, 0xDB, 0x29, 0x65, 0x81, 0x00, 0x00, 0x03, 0xA5, 0x34, 0xDF, 0x1C, 0xDE,
+0xFC, 0xDF, 0x1C, 0x81, 0xDE, 0xFC, 0x81, 0xDF, 0x1C, 0x00, 0xBD, 0xD7, 0x86, 0x00, 0x00, 0x07,
+0x5A, 0xEC, 0xA5, 0x14, 0xC6, 0x38, 0xDE, 0xFB, 0xDE, 0xFC, 0xE7, 0x1C, 0xE7, 0x3C, 0xC6, 0x18,
+0x81, 0x00, 0x00, 0x00, 0x9C, 0xF3, 0x82, 0xDF, 0x1C, 0x00, 0xD6, 0xDB, 0x81, 0xD6, 0xBA, 0x0B,
+0xD6, 0x9A, 0xD6, 0xBA, 0xDE, 0xFB, 0xDF, 0x1C, 0xDE, 0xFC, 0x7C, 0x10, 0x00, 0x00, 0x42, 0x48,
+0xE7, 0x3C, 0xE7, 0x1C, 0xDF, 0x1C, 0x31, 0x86, 0x85, 0x00, 0x00, 0x00, 0x84, 0x30, 0x81, 0xE7,
+0x1C, 0x00, 0xCE, 0x79, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x81, 0xDF, 0x1C, 0x81, 0xDE, 0xFC,
+0x84, 0xDF, 0x1C, 0x00, 0x84, 0x51, 0xAA, 0x00, 0x00, 0x00, 0x73, 0xAE, 0x81, 0xDF, 0x1C, 0x03,
+0xA5, 0x14, 0xA5, 0x75, 0xDE, 0xFC, 0xBE, 0x18, 0x81, 0x00, 0x00, 0x06, 0xBE, 0x18, 0xDF, 0x1C,
+0xD6, 0x9A, 0x63, 0x6D, 0xDF, 0x1C, 0xE7, 0x3C, 0x84, 0x10, 0x82, 0x00, 0x00, 0x00, 0xAD, 0x96,
+0x81, 0xDE, 0xFC, 0x00, 0xB5, 0xD7, 0x85, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x81, 0xDF, 0x1C, 0x04,
+0xDE, 0xFC, 0x18, 0xE3, 0x00, 0x00, 0x7C, 0x10, 0xDE, 0xFC, 0x85, 0xDF, 0x1C, 0x02, 0xE7, 0x1C,
+0xCE, 0x7A, 0x4A, 0x8A, 0x82, 0x00, 0x00, 0x01, 0xA5, 0x35, 0xDF, 0x1C, 0x81, 0xDE, 0xFC, 0x01,
+0xBD, 0xF8, 0x84, 0x30, 0x82, 0xDF, 0x1C, 0x00, 0x8C, 0x71, 0x88, 0x00, 0x00, 0x02, 0x42, 0x08,
+0xAD, 0x76, 0xE7, 0x3C, 0x81, 0xE7, 0x1C, 0x02, 0x42, 0x08, 0x00, 0x00, 0x9C, 0xF3, 0x81, 0xDF,
+0x1C, 0x00, 0xA5, 0x34, 0x84, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x81, 0xDE, 0xFC, 0x03, 0x84, 0x30,
+0x00, 0x00, 0x10, 0xA2, 0xD6, 0xDB, 0x81, 0xDF, 0x1C, 0x00, 0x84, 0x30, 0x85, 0x00, 0x00, 0x03,
+0xB5, 0xB6, 0xDF, 0x1C, 0xE7, 0x1C, 0xB5, 0xB6, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x39, 0x83, 0xDF,
+0x1C, 0x04, 0xE7, 0x1C, 0xE7, 0x3C, 0xE7, 0x1C, 0xDE, 0xFB, 0x94, 0x92, 0xAB, 0x00, 0x00, 0x06,
+0x19, 0x03, 0xD6, 0xDB, 0xDF, 0x1C, 0xC6, 0x59, 0xCE, 0x7A, 0xDE, 0xFC, 0x8C, 0x92, 0x81, 0x00,
+0x00, 0x00, 0x94, 0xB2, 0x81, 0xDF, 0x1C, 0x03, 0xAD, 0xB6, 0xDF, 0x1C, 0xDE, 0xFC, 0x29, 0x65,
+0x82, 0x00, 0x00, 0x01, 0x6B, 0x6D, 0xDF, 0x1C, 0x81, 0xDE, 0xFC, 0x00, 0x84, 0x51, 0x83, 0x00,
+0x00, 0x01, 0x3A, 0x08, 0xCE, 0x9A, 0x81, 0xDF, 0x1C, 0x00, 0xAD, 0x96, 0x81, 0x00, 0x00, 0x00,
+0x7C, 0x10, 0x81, 0xDF, 0x1C, 0x00, 0xCE, 0x59, 0x81, 0x8C, 0x92, 0x03, 0x9D, 0x14, 0xE7, 0x3C,
+0xE7, 0x1C, 0xC6, 0x59, 0x83, 0x00, 0x00, 0x06, 0xA5, 0x55, 0xE7, 0x1C, 0xDE, 0xFC, 0xC6, 0x59,
+0x29, 0x65, 0x00, 0x00, 0xB5, 0xB6, 0x81, 0xDF, 0x1C, 0x01, 0xD6, 0xFB, 0x5A, 0xCB, 0x81, 0x00,
+0x00, 0x02, 0x18, 0xE3, 0xCE, 0x59, 0x73, 0x8E, 0x83, 0x00, 0x00, 0x00, 0x18, 0xC3, 0x82, 0xDF,
+0x1C, 0x02, 0x5A, 0xCB, 0x00, 0x00, 0x9C, 0xF3, 0x81, 0xDF, 0x1C, 0x00, 0x9D, 0x14, 0x84, 0x00,
+0x00, 0x03, 0xBD, 0xD7, 0xDE, 0xFC, 0xDF, 0x1C, 0x84, 0x30, 0x81, 0x00, 0x00, 0x00, 0xAD, 0x75,
+0x81, 0xDF, 0x1C, 0x01, 0xD6, 0xBA, 0x4A, 0x69, 0x83, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xDE, 0xFC,
+0x81, 0xDF, 0x1C, 0x00, 0x6B, 0x6D, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x59, 0x81, 0xDF, 0x1C, 0x00,
+0xAD, 0x96, 0x81, 0x9C, 0xF3, 0x02, 0x94, 0xD3, 0x7B, 0xEF, 0x29, 0x65, 0xAD, 0x00, 0x00, 0x00,
+0xB5, 0xD7, 0x83, 0xDF, 0x1C, 0x00, 0x3A, 0x08, 0x81, 0x00, 0x00, 0x00, 0x52, 0xAA, 0x82, 0xDF,
+0x1C, 0x01, 0xDE, 0xFC, 0xB5, 0xD7, 0x84, 0x00, 0x00, 0x01, 0xB5, 0xB6, 0xDF, 0x1C, 0x81, 0xDE,
+0xFC, 0x04, 0xB5, 0xD7, 0x84, 0x30, 0x6B, 0x8E, 0x9C, 0xF3, 0xD6, 0xBA, 0x81, 0xDE, 0xFC, 0x01,
+0xD6, 0xBA, 0x39, 0xC7, 0x81, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x81, 0xDF, 0x1C, 0x00, 0xBD, 0xD7,
+0x82, 0x00, 0x00, 0x03, 0xC6, 0x59, 0xDF, 0x1C, 0xDE, 0xFC, 0x7C, 0x10, 0x82, 0x00, 0x00, 0x00,
+0xA5, 0x34, 0x81, 0xDF, 0x1C, 0x00, 0x8C, 0x92, 0x81, 0x00, 0x00, 0x01, 0x31, 0x86, 0xCE, 0x9A,
+0x81, 0xDF, 0x1C, 0x0A, 0xCE, 0x79, 0x21, 0x04, 0x00, 0x00, 0x73, 0xAE, 0xE7, 0x3C, 0xE7, 0x1C,
+0xC6, 0x38, 0x8C, 0x92, 0x63, 0x0C, 0x5A, 0xEB, 0xAD, 0x55, 0x81, 0xDF, 0x1C, 0x03, 0xDE, 0xFB,
+0x21, 0x44, 0x00, 0x00, 0x9C, 0xF3, 0x81, 0xDF, 0x1C, 0x00, 0x9D, 0x14, 0x84, 0x00, 0x00, 0x03,
+0xBE, 0x18, 0xDE, 0xFC, 0xDF, 0x1C, 0x84, 0x30, 0x81, 0x00, 0x00, 0x01, 0x39, 0xE7, 0xD6, 0xBB,
+0x81, 0xDF, 0x1C, 0x04, 0xD6, 0xBB, 0x9C, 0xF3, 0x73, 0xAE, 0x73, 0xCF, 0xAD, 0x96, 0x82, 0xDF,
+0x1C, 0x00, 0xB5, 0xB6, 0x82, 0x00, 0x00, 0x00, 0xC6, 0x59, 0x81, 0xDF, 0x1C, 0x00, 0x73, 0xAE,
+0xB2, 0x00, 0x00, 0x00, 0x84, 0x51, 0x82, 0xDF, 0x1C, 0x00, 0xC6, 0x59, 0x83, 0x00, 0x00, 0x00,
+0xD6, 0xBA, 0x82, 0xDF, 0x1C, 0x00, 0x84, 0x30, 0x84, 0x00, 0x00, 0x01, 0x21, 0x24, 0xBE, 0x18,
+0x82, 0xDF, 0x1C, 0x81, 0xDF, 0x3C, 0x82, 0xDF, 0x1C, 0x01, 0xCE, 0x9A, 0x5A, 0xCB, 0x82, 0x00,
+0x00, 0x00, 0x7B, 0xEF, 0x81, 0xDF, 0x1C, 0x00, 0xBD, 0xF7, 0x82, 0x00, 0x00, 0x00, 0x73, 0x8E,
+0x81, 0xDF, 0x1C, 0x01, 0xD6, 0x9A, 0x29, 0x45, 0x81, 0x00, 0x00, 0x03, 0xA5, 0x14, 0xDF, 0x1C,
+0xDE, 0xFC, 0xA5, 0x34, 0x82, 0x00, 0x00, 0x00, 0x73, 0xAE, 0x81, 0xDF, 0x1C, 0x03, 0xE7, 0x3C,
+0xAD, 0x75, 0x00, 0x00, 0x8C, 0x51, 0x81, 0xE7, 0x1C, 0x03, 0xDF, 0x1C, 0xE7, 0x1C, 0xE7, 0x3D,
+0xE7, 0x3C, 0x81, 0xDF, 0x1C, 0x01, 0xE7, 0x1C, 0x9C, 0xF3, 0x81, 0x00, 0x00, 0x00, 0x9D, 0x14,
+0x81, 0xDF, 0x1C, 0x00, 0x9D, 0x14, 0x84, 0x00, 0x00, 0x03, 0xBE, 0x18, 0xDF, 0x1C, 0xDE, 0xFC,
+0x84, 0x30, 0x82, 0x00, 0x00, 0x01, 0x63, 0x0C, 0xD6, 0xBA, 0x81, 0xDF, 0x1C, 0x01, 0xE7, 0x1C,
+0xE7, 0x3C, 0x81, 0xDF, 0x1C, 0x03, 0xE7, 0x1C, 0xE7, 0x3C, 0xC6, 0x38, 0x21, 0x04, 0x82, 0x00,
+0x00, 0x00, 0xC6, 0x38, 0x81, 0xDF, 0x1C, 0x00, 0x73, 0xAE, 0xB2, 0x00, 0x00, 0x04, 0x31, 0xA6,
+0xE7, 0x3C, 0xE7, 0x3D, 0xE7, 0x3C, 0xA5, 0x14, 0x83, 0x00, 0x00, 0x01, 0xAD, 0x96, 0xDF, 0x3C,
+0x81, 0xDF, 0x1C, 0x00, 0x31, 0x86, 0x85, 0x00, 0x00, 0x03, 0x10, 0xA2, 0x9C, 0xD3, 0xD6, 0xDB,
+0xE7, 0x3D, 0x82, 0xDF, 0x1C, 0x02, 0xDE, 0xFC, 0xAD, 0x75, 0x31, 0xA6, 0x83, 0x00, 0x00, 0x00,
+0x7B, 0xEF, 0x81, 0xDF, 0x1C, 0x00, 0xBD, 0xF7, 0x83, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x81, 0xE7,
+0x3C, 0x00, 0xAD, 0x55, 0x81, 0x00, 0x00, 0x00, 0xA5, 0x34, 0x81, 0xDF, 0x1C, 0x00, 0xB5, 0xD7,
+0x83, 0x00, 0x00, 0x08, 0xAD, 0x75, 0xE7, 0x5D, 0xE7, 0x3D, 0xE7, 0x3C, 0x73, 0xAE, 0x00, 0x00,
+0x52, 0x8A, 0xAD, 0x55, 0xD6, 0xDB, 0x82, 0xE7, 0x3C, 0x02, 0xE7, 0x1C, 0xD6, 0xDB, 0x94, 0x92,
+0x82, 0x00, 0x00, 0x03, 0x9D, 0x14, 0xE7, 0x3D, 0xDF, 0x1C, 0xA5, 0x34, 0x84, 0x00, 0x00, 0x03,
+0xBE, 0x18, 0xE7, 0x1C, 0xDF, 0x1C, 0x84, 0x30, 0x83, 0x00, 0x00, 0x04, 0x39, 0xE7, 0xAD, 0x96,
+0xDF, 0x1C, 0xE7, 0x3D, 0xE7, 0x3C, 0x81, 0xDF, 0x1C, 0x02, 0xD6, 0xBA, 0x94, 0xD3, 0x08, 0x82,
+0x83, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x81, 0xDF, 0x1C, 0x00, 0x73, 0xCF, 0xB3, 0x00, 0x00, 0x00,
+0x42, 0x49, 0x81, 0x52, 0xAA, 0x00, 0x21, 0x24, 0x83, 0x00, 0x00, 0x03, 0x29, 0x65, 0x52, 0xCB,
+0x5A, 0xCB, 0x52, 0x8A, 0x88, 0x00, 0x00, 0x05, 0x10, 0xA2, 0x63, 0x0C, 0x7C, 0x10, 0x84, 0x10,
+0x63, 0x4D, 0x21, 0x04, 0x85, 0x00, 0x00, 0x00, 0x29, 0x45, 0x81, 0x5A, 0xCB, 0x00, 0x42, 0x28,
+0x83, 0x00, 0x00, 0x00, 0x29, 0x65, 0x81, 0x52, 0x8A, 0x00, 0x4A, 0x49, 0x81, 0x00, 0x00, 0x03,
+0x31, 0x86, 0x42, 0x49, 0x42, 0x48, 0x39, 0xC7, 0x83, 0x00, 0x00, 0x00, 0x10, 0xA2, 0x82, 0x52,
+0xAA, 0x00, 0x39, 0xE7, 0x82, 0x00, 0x00, 0x01, 0x18, 0xC3, 0x63, 0x2C, 0x81, 0x84, 0x30, 0x01,
+0x63, 0x2C, 0x18, 0xC3, 0x83, 0x00, 0x00, 0x03, 0x31, 0xA6, 0x52, 0xCB, 0x52, 0xAA, 0x39, 0xC7,
+0x84, 0x00, 0x00, 0x00, 0x3A, 0x08, 0x81, 0x4A, 0x69, 0x00, 0x21, 0x44, 0x85, 0x00, 0x00, 0x05,
+0x29, 0x65, 0x73, 0xAF, 0x8C, 0x71, 0x84, 0x30, 0x5A, 0xEB, 0x10, 0x82, 0x85, 0x00, 0x00, 0x00,
+0x42, 0x49, 0x81, 0x52, 0xAA, 0x00, 0x21, 0x24, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x04, 0x51, 0x20,
+0xA2, 0x62, 0xBA, 0xC3, 0xAA, 0x83, 0x69, 0x40, 0x82, 0x00, 0x00, 0x02, 0x59, 0x00, 0xA2, 0x62,
+0x61, 0x41, 0x82, 0x00, 0x00, 0x04, 0x71, 0xA1, 0xAA, 0xA3, 0x40, 0xC0, 0x00, 0x00, 0x61, 0x20,
+0x82, 0xA2, 0x42, 0x81, 0xA2, 0x63, 0x00, 0x51, 0x21, 0x81, 0x00, 0x00, 0x01, 0x9A, 0x22, 0x91,
+0xE2, 0x82, 0x00, 0x00, 0x02, 0x79, 0xA1, 0xAA, 0x42, 0x18, 0x20, 0xFB, 0x00, 0x00, 0x06, 0x92,
+0x02, 0xE3, 0x84, 0xDB, 0x44, 0xCB, 0x03, 0xDB, 0x44, 0xE3, 0x63, 0x92, 0x22, 0x81, 0x00, 0x00,
+0x02, 0x48, 0xC0, 0xEB, 0x64, 0xC2, 0xE3, 0x82, 0x00, 0x00, 0x0A, 0xD3, 0x24, 0xE3, 0x85, 0x18,
+0x20, 0x00, 0x00, 0x89, 0xE2, 0xEB, 0x44, 0xD3, 0x03, 0xCB, 0x03, 0xCB, 0x04, 0xD3, 0x24, 0x69,
+0x81, 0x81, 0x00, 0x00, 0x02, 0xE3, 0x23, 0xEB, 0x84, 0x92, 0x02, 0x81, 0x00, 0x00, 0x02, 0xB2,
+0xA3, 0xEB, 0x85, 0x30, 0x80, 0xFA, 0x00, 0x00, 0x08, 0x61, 0x40, 0xEB, 0x84, 0xCB, 0x03, 0x38,
+0x80, 0x00, 0x00, 0x28, 0x40, 0xC2, 0xE3, 0xEB, 0x84, 0x61, 0x41, 0x81, 0x00, 0x00, 0x06, 0xCB,
+0x03, 0xEB, 0xA4, 0x38, 0xA0, 0x00, 0x00, 0x51, 0x00, 0xEB, 0x84, 0xA2, 0xA3, 0x81, 0x00, 0x00,
+0x02, 0x92, 0x01, 0xEB, 0x84, 0x51, 0x00, 0x84, 0x00, 0x00, 0x01, 0x08, 0x00, 0xE3, 0x44, 0x81,
+0xEB, 0x84, 0x04, 0x61, 0x20, 0x00, 0x00, 0xB2, 0x82, 0xEB, 0x84, 0x30, 0x80, 0xFA, 0x00, 0x00,
+0x02, 0xAA, 0x63, 0xEB, 0x84, 0x71, 0x81, 0x82, 0x00, 0x00, 0x02, 0x59, 0x20, 0xEB, 0x85, 0xAA,
+0xA3, 0x81, 0x00, 0x00, 0x06, 0x89, 0xE2, 0xEB, 0x84, 0x92, 0x02, 0x00, 0x00, 0xA2, 0x63, 0xEB,
+0x84, 0x48, 0xE0, 0x81, 0x00, 0x00, 0x05, 0x92, 0x22, 0xEB, 0x85, 0xAA, 0x83, 0x92, 0x42, 0x92,
+0x02, 0x81, 0xE2, 0x81, 0x00, 0x00, 0x08, 0x08, 0x00, 0xE3, 0x64, 0xCB, 0x24, 0xDB, 0x44, 0xDB,
+0x23, 0x30, 0x60, 0xB2, 0x82, 0xEB, 0x84, 0x30, 0xA0, 0xEB, 0x00, 0x00, 0x00, 0x10, 0xA2, 0x82,
+0xD6, 0xBA, 0x81, 0xCE, 0x9A, 0x00, 0xD6, 0xBA, 0x81, 0xD6, 0x9A, 0x00, 0x7B, 0xCF, 0x84, 0x00,
+0x00, 0x02, 0xBA, 0xA3, 0xEB, 0xA4, 0x51, 0x00, 0x82, 0x00, 0x00, 0x02, 0x40, 0xC0, 0xEB, 0x84,
+0xBA, 0xE3, 0x81, 0x00, 0x00, 0x05, 0x28, 0x60, 0xE3, 0x63, 0xCB, 0x03, 0x18, 0x00, 0xDB, 0x65,
+0xC2, 0xE3, 0x82, 0x00, 0x00, 0x05, 0x92, 0x21, 0xEB, 0x85, 0xDB, 0x64, 0xD3, 0x44, 0xD3, 0x24,
+0xC2, 0xC3, 0x81, 0x00, 0x00, 0x08, 0x08, 0x00, 0xE3, 0x85, 0xC3, 0x04, 0x69, 0x61, 0xE3, 0x63,
+0xC2, 0xA2, 0xB2, 0xA3, 0xEB, 0xA5, 0x30, 0xA0, 0x84, 0x00, 0x00, 0x02, 0x94, 0xD3, 0xD6, 0xBA,
+0xD6, 0x9A, 0x82, 0xCE, 0x9A, 0x81, 0xD6, 0xBA, 0x00, 0xCE, 0x99, 0xDD, 0x00, 0x00, 0x05, 0x00,
+0x20, 0x7B, 0xCF, 0x7B, 0xEF, 0x7B, 0xCF, 0x73, 0xCF, 0x7B, 0xCF, 0x82, 0x7B, 0xEF, 0x00, 0x42,
+0x08, 0x84, 0x00, 0x00, 0x02, 0x9A, 0x42, 0xEB, 0x84, 0x8A, 0x01, 0x82, 0x00, 0x00, 0x02, 0x89,
+0xE1, 0xEB, 0xA4, 0xA2, 0x62, 0x82, 0x00, 0x00, 0x04, 0xB2, 0xA2, 0xEB, 0x84, 0x91, 0xE1, 0xEB,
+0xC5, 0x79, 0xC1, 0x82, 0x00, 0x00, 0x02, 0x8A, 0x01, 0xEB, 0x84, 0x59, 0x40, 0x84, 0x00, 0x00,
+0x08, 0x08, 0x00, 0xE3, 0x84, 0xC3, 0x03, 0x00, 0x00, 0x92, 0x21, 0xEB, 0x83, 0xEB, 0x84, 0xEB,
+0xA4, 0x30, 0x80, 0x84, 0x00, 0x00, 0x00, 0x52, 0x8A, 0x81, 0x7B, 0xCF, 0x05, 0x73, 0xCF, 0x73,
+0xAE, 0x73, 0xAF, 0x73, 0xCF, 0x7B, 0xCF, 0x73, 0xAE, 0xEC, 0x00, 0x00, 0x08, 0x38, 0x80, 0xDB,
+0x43, 0xE3, 0x43, 0x92, 0x01, 0x61, 0x41, 0x92, 0x02, 0xE3, 0x64, 0xDB, 0x64, 0x38, 0xA0, 0x82,
+0x00, 0x00, 0x00, 0x69, 0x60, 0x81, 0xEB, 0x84, 0x01, 0xDB, 0x64, 0x08, 0x00, 0x82, 0x00, 0x00,
+0x02, 0x8A, 0x01, 0xE3, 0x64, 0x79, 0xC1, 0x81, 0x59, 0x41, 0x05, 0x61, 0x41, 0x28, 0x60, 0x00,
+0x00, 0x08, 0x00, 0xDB, 0x64, 0xC2, 0xE3, 0x81, 0x00, 0x00, 0x03, 0xC2, 0xE3, 0xF3, 0xC4, 0xEB,
+0xA4, 0x30, 0x80, 0xFB, 0x00, 0x00, 0x01, 0x59, 0x20, 0xD3, 0x23, 0x81, 0xE3, 0x84, 0x02, 0xEB,
+0x84, 0xD3, 0x44, 0x61, 0x61, 0x83, 0x00, 0x00, 0x03, 0x08, 0x00, 0xD3, 0x44, 0xEB, 0xC4, 0x9A,
+0x42, 0x83, 0x00, 0x00, 0x00, 0x8A, 0x01, 0x82, 0xE3, 0x64, 0x06, 0xE3, 0xA5, 0xEB, 0xC5, 0x79,
+0xE2, 0x00, 0x00, 0x08, 0x00, 0xE3, 0x64, 0xBA, 0xE3, 0x81, 0x00, 0x00, 0x03, 0x28, 0x60, 0xDB,
+0x64, 0xEB, 0x83, 0x30, 0x80, 0xFC, 0x00, 0x00, 0x04, 0x08, 0x00, 0x61, 0x40, 0x79, 0xC1, 0x61,
+0x40, 0x10, 0x00, 0x85, 0x00, 0x00, 0x02, 0x48, 0xE0, 0x61, 0x40, 0x18, 0x20, 0x83, 0x00, 0x00,
+0x01, 0x28, 0x60, 0x50, 0xE0, 0x81, 0x48, 0xE0, 0x02, 0x51, 0x00, 0x51, 0x20, 0x28, 0x60, 0x81,
+0x00, 0x00, 0x01, 0x40, 0xC0, 0x38, 0x80, 0x82, 0x00, 0x00, 0x01, 0x30, 0x60, 0x48, 0xC0, 0xFF,
+0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+0xDF, 0x00, 0x00,
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+// Just enough of TFT_eSPI for Chart to build in the native environment.
+// Drawing calls only count, so benchmarks measure Chart's own work rather
+// than the SPI transfers behind it.
+
+#include <stdint.h>
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+#define TFT_BLACK   0x0000
+#define TFT_NAVY    0x000F
+#define TFT_WHITE   0xFFFF
+#define TFT_RED     0xF800
+#define TFT_GREEN   0x07E0
+#define TFT_YELLOW  0xFFE0
+#define TFT_CYAN    0x07FF
+#define TFT_MAGENTA 0xF81F
+#define TFT_ORANGE  0xFDA0
+#define TFT_PINK    0xFE19
+
+#define TL_DATUM 0
+#define TR_DATUM 2
+#define BR_DATUM 8
+
+class TFT_eSPI {
+public:
+    uint32_t pixels = 0;     // Pixel-sized calls: points and line segments
+    uint32_t fills = 0;      // Rectangles, fast lines and text
+
+    void drawPixel(int32_t, int32_t, uint32_t) { pixels++; }
+    void drawLine(int32_t, int32_t, int32_t, int32_t, uint32_t) { pixels++; }
+    void drawFastHLine(int32_t, int32_t, int32_t, uint32_t) { fills++; }
+    void drawFastVLine(int32_t, int32_t, int32_t, uint32_t) { fills++; }
+    void drawRect(int32_t, int32_t, int32_t, int32_t, uint32_t) { fills++; }
+    void fillRect(int32_t, int32_t, int32_t, int32_t, uint32_t) { fills++; }
+    int16_t drawString(const char*, int32_t, int32_t) { fills++; return 0; }
+    void setTextSize(uint8_t) {}
+    void setTextColor(uint16_t, uint16_t) {}
+    void setTextDatum(uint8_t) {}
+};
@@ -0,0 +1,111 @@
+// Chart transforms and redraw cost on the host: pio test -e native -f test_chart
+// Timings are host nanoseconds, useful for comparing changes rather than as
+// ESP32 figures.
+
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "Chart.h"
+
+static TFT_eSPI tft;
+static volatile int32_t sink;
+
+static double nsPer(std::chrono::steady_clock::time_point start, uint32_t count) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / count;
+}
+
+static void report(const char* what, double ns) {
+    char line[80];
+    snprintf(line, sizeof(line), "%s: %.1f ns", what, ns);
+    TEST_MESSAGE(line);
+}
+
+static void setupChart(Chart& chart, Chart::Overflow overflow) {
+    chart.begin(tft, 0, 14, 159, 114);
+    chart.setTimeAxis({15 * 60000UL, overflow, 5 * 60000UL, Chart::LABEL_MINUTES});
+    chart.setValueAxis({0, 2500, overflow, 200, 100, "c"});
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_limits_map_to_edge_pixels() {
+    Chart chart;
+    setupChart(chart, Chart::CLIP);
+    TEST_ASSERT_EQUAL(0, chart.timeToX(0));
+    TEST_ASSERT_EQUAL(158, chart.timeToX(15 * 60000UL));
+    TEST_ASSERT_EQUAL(14 + 113, chart.valueToY(0));
+    TEST_ASSERT_EQUAL(14, chart.valueToY(2500));
+    TEST_ASSERT_EQUAL(14, chart.percentToY(1000));
+}
+
+void test_extend_rounds_out_to_step() {
+    Chart chart;
+    setupChart(chart, Chart::EXTEND);
+    int8_t s = chart.addSeries(TFT_RED, Chart::AXIS_VALUE);
+    chart.plot(s, 16 * 60000UL, 2600);
+    TEST_ASSERT_EQUAL_UINT32(20 * 60000UL, chart.spanMs());
+    TEST_ASSERT_EQUAL(2800, chart.maxValue());
+}
+
+void bench_transform() {
+    Chart chart;
+    setupChart(chart, Chart::CLIP);
+    const uint32_t N = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; ++i) {
+        sink = chart.timeToX(i % 900000UL) + chart.valueToY((int32_t)(i % 2500));
+    }
+    report("timeToX + valueToY", nsPer(start, N));
+}
+
+void bench_plot() {
+    Chart chart;
+    setupChart(chart, Chart::EXTEND);
+    int8_t s = chart.addSeries(TFT_RED, Chart::AXIS_VALUE);
+    const uint32_t N = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; ++i) {
+        chart.plot(s, (i % 3600) * 250UL, 200 + (int32_t)(i % 2000));
+    }
+    report("plot() per live point", nsPer(start, N));
+}
+
+// A run's replay: 900 buckets of five series, as RunTraces draws from runHistory
+static void replayLayer(Chart& chart, void* context) {
+    const int8_t* series = (const int8_t*)context;
+    for (uint32_t i = 0; i < 900; ++i) {
+        uint32_t t = i * 1000UL;
+        chart.bar(t, 1990 + (int32_t)i, 2010 + (int32_t)i, TFT_NAVY);
+        for (uint8_t k = 0; k < 5; ++k) chart.plot(series[k], t, 200 + (int32_t)(i * 2 + k));
+    }
+}
+
+void bench_redraw() {
+    Chart chart;
+    setupChart(chart, Chart::EXTEND);
+    int8_t series[5];
+    for (uint8_t k = 0; k < 5; ++k) series[k] = chart.addSeries(TFT_RED, Chart::AXIS_VALUE);
+    chart.addLayer(replayLayer, series);
+    const uint32_t N = 2000;
+    tft.pixels = tft.fills = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; ++i) chart.redraw();
+    double ns = nsPer(start, N);
+    report("redraw() with a 900-bucket replay", ns);
+    char line[80];
+    snprintf(line, sizeof(line), "  %u pixel and %u fill calls per redraw",
+             (unsigned)(tft.pixels / N), (unsigned)(tft.fills / N));
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_limits_map_to_edge_pixels);
+    RUN_TEST(test_extend_rounds_out_to_step);
+    RUN_TEST(bench_transform);
+    RUN_TEST(bench_plot);
+    RUN_TEST(bench_redraw);
+    return UNITY_END();
+}
@@ -0,0 +1,136 @@
+// FastFormat against snprintf on the host: pio test -e native -f test_format
+// Timings are host nanoseconds, useful for comparing changes rather than as
+// ESP32 figures.
+
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include "FastFormat.h"
+
+static volatile size_t sink;
+
+static double nsPer(std::chrono::steady_clock::time_point start, uint32_t count) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / count;
+}
+
+static void report(const char* what, double fastNs, double printfNs) {
+    char line[96];
+    snprintf(line, sizeof(line), "%s: FastFormat %.0f ns, snprintf %.0f ns", what, fastNs, printfNs);
+    TEST_MESSAGE(line);
+}
+
+// printf's "-0" for a negative value that rounds to zero
+static bool negativeZero(const char* s) {
+    return s[0] == '-' && strspn(s + 1, "0.") == strlen(s + 1);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_decimal_matches_printf() {
+    srand(1);
+    uint32_t mismatches = 0;
+    for (uint32_t k = 0; k < 200000; ++k) {
+        // Random floats, and values with 4-5 significant decimals like 566.1985
+        float v = (k % 2) ? (rand() / (float)RAND_MAX - 0.3f) * 600.0f : (rand() % 3000000) / 1e4f;
+        for (uint8_t d = 0; d <= FastFormat::MAX_DECIMALS; ++d) {
+            char fast[24], ref[24];
+            FastFormat(fast, sizeof(fast)).decimal(v, d);
+            snprintf(ref, sizeof(ref), "%.*f", d, v);
+            if (strcmp(fast, ref) == 0 || negativeZero(ref)) continue;
+            // Exact binary ties round away from zero, not to even
+            double scaled = fabs((double)v * pow(10, d));
+            if (scaled - floor(scaled) == 0.5) continue;
+            mismatches++;
+        }
+    }
+    TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+void test_decimal_rounding() {
+    char text[24];
+    FastFormat(text, sizeof(text)).decimal(566.1985f, 3);
+    TEST_ASSERT_EQUAL_STRING("566.198", text);
+    FastFormat(text, sizeof(text)).decimal(0.125f, 2);
+    TEST_ASSERT_EQUAL_STRING("0.13", text);
+    FastFormat(text, sizeof(text)).decimal(-0.04f, 1, 5);
+    TEST_ASSERT_EQUAL_STRING("  0.0", text);
+}
+
+// The reflow status bar, in its normal (not door prompt) form
+void bench_status_line() {
+    const uint32_t N = 200000;
+    FixedTemp temp = toFixedTemp(183.4f);
+    float rate = 1.27f, output = 63.4f;
+    char fast[48], ref[48];
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; ++i) {
+        FastFormat text(fast, sizeof(fast));
+        text.temp(temp, 0).str("C ").decimal(rate, 1, 0, true).str("C/s Out:").decimal(output, 0).chr('%').spaces(4);
+        sink = text.length();
+    }
+    double fastNs = nsPer(start, N);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; ++i) {
+        sink = snprintf(ref, sizeof(ref), "%.0fC %+.1fC/s Out:%.0f%%    ", fixedToC(temp), rate, output);
+    }
+    double printfNs = nsPer(start, N);
+
+    TEST_ASSERT_EQUAL_STRING(ref, fast);
+    report("status line", fastNs, printfNs);
+}
+
+// The per-tick serial log line, as the reflow loop builds it
+void bench_log_line() {
+    const uint32_t N = 100000;
+    FixedTemp temp = toFixedTemp(183.4f);
+    float setpoint = 185.0f, diff = -1.6f, rate = 1.27f, lead = 4.2f;
+    float diffAvg = 2.35f, diffMax = 0.87f;
+    float ff = 20.1f, out = 63.4f, p = 12.3f, i = 45.6f, d = -7.8f, ffPower = 21.9f;
+    int fan = 100;
+    char fast[160], ref[160];
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t k = 0; k < N; ++k) {
+        FastFormat text(fast, sizeof(fast));
+        text.str("P:").str("Reflow")
+            .str(" Temp:(A:").temp(temp, 1).str(",S:").decimal(setpoint, 1).str(",D:").decimal(diff, 1)
+            .str(") Rate:").decimal(rate, 2).str(" Lead:").decimal(lead, 1)
+            .str(" TStats(A:").decimal(diffAvg, 1).str(" M:").decimal(diffMax, 1)
+            .str(") FF:").decimal(ff, 1)
+            .str(" Out:").decimal(out, 0)
+            .str(" (P:").decimal(p, 0).str(",I:").decimal(i, 0)
+            .str(",D:").decimal(d, 0).str(",F:").decimal(ffPower, 0)
+            .str(") Fan:").integer(fan).chr('\n');
+        sink = text.length();
+    }
+    double fastNs = nsPer(start, N);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t k = 0; k < N; ++k) {
+        sink = snprintf(ref, sizeof(ref),
+                        "P:%s Temp:(A:%.1f,S:%.1f,D:%.1f) Rate:%.2f Lead:%.1f TStats(A:%.1f M:%.1f) FF:%.1f"
+                        " Out:%.0f (P:%.0f,I:%.0f,D:%.0f,F:%.0f) Fan:%d\n",
+                        "Reflow", fixedToC(temp), setpoint, diff, rate, lead, diffAvg, diffMax, ff,
+                        out, p, i, d, ffPower, fan);
+    }
+    double printfNs = nsPer(start, N);
+
+    TEST_ASSERT_EQUAL_STRING(ref, fast);
+    report("serial log line", fastNs, printfNs);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_decimal_matches_printf);
+    RUN_TEST(test_decimal_rounding);
+    RUN_TEST(bench_status_line);
+    RUN_TEST(bench_log_line);
+    return UNITY_END();
+}
@@ -0,0 +1,313 @@
+# Generates image headers in src/ from the sources listed in Logo/assets.ini.
+# Runs before every PlatformIO build (extra_scripts = pre:tools/assets.py)
+# and only rewrites a header when its contents change, so unchanged assets
+# don't trigger a rebuild. It can also be run by hand:
+#
+#   python3 tools/assets.py
+#
+# Each [section] of the manifest becomes src/<section>.h (or `output`):
+#   source    PNG (8-bit, non-interlaced), binary PPM, SVG (rasterized with
+#             rsvg-convert or inkscape, whichever is on the PATH) or an
+#             existing RGB565 C array, relative to the manifest
+#   width, height
+#             Pixel size. PNG/PPM/C sources must already be this size.
+#   encoding  raw: const uint16_t <name>[] for pushImage()
+#             rle: const uint8_t <name>Rle[] for RleImage::draw()
+#   colors    Reduce to the N most common colours before encoding (0 = keep).
+#             Fewer colours give longer runs.
+#   swap      yes (default): store pixels byte-swapped, as TFT_eSPI pushes
+#             them with setSwapBytes(false). C array sources are copied as
+#             they are; swap then only says which order they are in.
+#
+# RLE stream, one packet after another until width*height pixels:
+#   0x80 | (n - 1), lo, hi            n copies of one pixel     (n = 1..128)
+#   n - 1, lo, hi, lo, hi, ...        n literal pixels          (n = 1..128)
+# Runs and literals may cross line ends.
+
+import configparser
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+MAX_PACKET = 128
+MANIFEST = os.path.join('Logo', 'assets.ini')
+
+
+class AssetError(Exception):
+    pass
+
+
+# --- Sources -----------------------------------------------------------------
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise AssetError('%s: not a PNG' % path)
+    pos = 8
+    idat = b''
+    palette = []
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+    if depth != 8 or interlace:
+        raise AssetError('%s: only 8-bit non-interlaced PNGs are supported' % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = prev[x]
+            c = prev[x - channels] if x >= channels else 0
+            if kind == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif kind == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif kind == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color == 0:
+                rgb, alpha = (px[0],) * 3, 255
+            elif color == 2:
+                rgb, alpha = tuple(px), 255
+            elif color == 3:
+                rgb, alpha = palette[px[0]], 255
+            elif color == 4:
+                rgb, alpha = (px[0],) * 3, px[1]
+            else:
+                rgb, alpha = tuple(px[:3]), px[3]
+            # Transparency is composited over the black screen background
+            pixels.append(tuple(v * alpha // 255 for v in rgb))
+    return width, height, pixels
+
+
+def read_ppm(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields = re.match(rb'P6\s+(?:#.*\s+)*(\d+)\s+(\d+)\s+(\d+)\s', data)
+    if not fields or int(fields.group(3)) != 255:
+        raise AssetError('%s: only binary 8-bit PPMs are supported' % path)
+    width, height = int(fields.group(1)), int(fields.group(2))
+    body = data[fields.end():]
+    pixels = [tuple(body[i:i + 3]) for i in range(0, width * height * 3, 3)]
+    return width, height, pixels
+
+
+def read_svg(path, width, height):
+    out = os.path.join(tempfile.mkdtemp(), 'asset.png')
+    if shutil.which('rsvg-convert'):
+        cmd = ['rsvg-convert', '-w', str(width), '-h', str(height), '-o', out, path]
+    elif shutil.which('inkscape'):
+        cmd = ['inkscape', path, '--export-type=png', '--export-filename=' + out,
+               '--export-width=%d' % width, '--export-height=%d' % height]
+    else:
+        raise AssetError('%s: install rsvg-convert or inkscape to rasterize SVG' % path)
+    subprocess.check_call(cmd)
+    return read_png(out)
+
+
+def read_c_array(path):
+    with open(path, 'r') as f:
+        text = f.read()
+    body = text.split('{', 1)[1].split('}', 1)[0]
+    body = re.sub(r'//.*', '', body)
+    return [int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{1,4})', body)]
+
+
+# --- Conversion --------------------------------------------------------------
+
+def to_rgb565(rgb):
+    r, g, b = rgb
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | (b * 31 + 127) // 255
+
+
+def swap_bytes(value):
+    return (value & 0xFF) << 8 | value >> 8
+
+
+def unpack565(value):
+    return (value >> 11) << 3, ((value >> 5) & 0x3F) << 2, (value & 0x1F) << 3
+
+
+def reduce_colors(pixels, colors, swapped):
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+    if len(counts) <= colors:
+        return pixels
+    keep = sorted(counts, key=lambda p: -counts[p])[:colors]
+    native = lambda p: unpack565(swap_bytes(p) if swapped else p)
+    palette = [(p, native(p)) for p in keep]
+    nearest = {}
+    for p in counts:
+        r, g, b = native(p)
+        nearest[p] = min(palette, key=lambda e: (e[1][0] - r) ** 2 + (e[1][1] - g) ** 2 + (e[1][2] - b) ** 2)[0]
+    return [nearest[p] for p in pixels]
+
+
+def run_length(pixels, i):
+    n = 1
+    while i + n < len(pixels) and n < MAX_PACKET and pixels[i + n] == pixels[i]:
+        n += 1
+    return n
+
+
+def compress(pixels):
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        n = run_length(pixels, i)
+        if n >= 2:
+            out += bytes([0x80 | (n - 1), pixels[i] & 0xFF, pixels[i] >> 8])
+            i += n
+            continue
+        # Literal up to the next run of two or more
+        start = i
+        while i < len(pixels) and i - start < MAX_PACKET and run_length(pixels, i) < 2:
+            i += 1
+        out.append(i - start - 1)
+        for p in pixels[start:i]:
+            out += bytes([p & 0xFF, p >> 8])
+    return out
+
+
+def decompress(data, count):
+    pixels = []
+    i = 0
+    while len(pixels) < count:
+        header = data[i]
+        n = (header & 0x7F) + 1
+        if header & 0x80:
+            pixels += [data[i + 1] | data[i + 2] << 8] * n
+            i += 3
+        else:
+            for k in range(n):
+                pixels.append(data[i + 1 + 2 * k] | data[i + 2 + 2 * k] << 8)
+            i += 1 + 2 * n
+    return pixels
+
+
+# --- Output ------------------------------------------------------------------
+
+def load(name, entry, base):
+    source = os.path.join(base, entry['source'])
+    width, height = entry.getint('width'), entry.getint('height')
+    swap = entry.getboolean('swap', True)
+    ext = os.path.splitext(source)[1].lower()
+    if ext in ('.h', '.c'):
+        pixels = read_c_array(source)
+    else:
+        if ext == '.png':
+            size = read_png(source)
+        elif ext == '.ppm':
+            size = read_ppm(source)
+        elif ext == '.svg':
+            size = read_svg(source, width, height)
+        else:
+            raise AssetError('[%s] unknown source type %s' % (name, ext))
+        pixels = [to_rgb565(p) for p in size[2]]
+        if swap:
+            pixels = [swap_bytes(p) for p in pixels]
+    if len(pixels) != width * height:
+        raise AssetError('[%s] expected %dx%d = %d pixels, %s has %d' %
+                         (name, width, height, width * height, entry['source'], len(pixels)))
+    colors = entry.getint('colors', 0)
+    if colors > 0:
+        pixels = reduce_colors(pixels, colors, swap)
+    return pixels
+
+
+def render(name, entry, pixels):
+    width, height = entry.getint('width'), entry.getint('height')
+    encoding = entry.get('encoding', 'raw')
+    macro = name.upper()
+    lines = [
+        '// Generated by tools/assets.py from Logo/%s, do not edit' % entry['source'],
+        '#pragma once',
+        '',
+        '#include <pgmspace.h>',
+        '',
+        '#define %s_WIDTH %d' % (macro, width),
+        '#define %s_HEIGHT %d' % (macro, height),
+        '',
+    ]
+    if encoding == 'rle':
+        data = compress(pixels)
+        if decompress(data, len(pixels)) != pixels:
+            raise AssetError('[%s] RLE round trip failed' % name)
+        lines.append('// %d bytes RLE, %d uncompressed' % (len(data), len(pixels) * 2))
+        lines.append('const uint8_t %sRle[%d] PROGMEM={' % (name, len(data)))
+        for i in range(0, len(data), 16):
+            lines.append(', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    elif encoding == 'raw':
+        lines.append('const uint16_t %s[%d] PROGMEM={' % (name, len(pixels)))
+        for i in range(0, len(pixels), 16):
+            lines.append(', '.join('0x%04X' % p for p in pixels[i:i + 16]) + ',')
+    else:
+        raise AssetError('[%s] unknown encoding %s' % (name, encoding))
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def generate(project):
+    manifest = os.path.join(project, MANIFEST)
+    config = configparser.ConfigParser()
+    if not config.read(manifest):
+        raise AssetError('%s not found' % manifest)
+    base = os.path.dirname(manifest)
+    for name in config.sections():
+        entry = config[name]
+        output = os.path.join(project, entry.get('output', os.path.join('src', name + '.h')))
+        text = render(name, entry, load(name, entry, base))
+        current = None
+        if os.path.exists(output):
+            with open(output, 'r') as f:
+                current = f.read()
+        if text != current:
+            with open(output, 'w') as f:
+                f.write(text)
+            print('assets: wrote %s' % os.path.relpath(output, project))
+
+
+try:
+    Import('env')
+except NameError:
+    env = None
+
+if env is not None:
+    generate(env.subst('$PROJECT_DIR'))
+elif __name__ == '__main__':
+    try:
+        generate(os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0]))))
+    except AssetError as e:
+        print('assets: %s' % e)
+        sys.exit(1)
@@ -0,0 +1,100 @@
+// Host-side decoder for the oven's binary telemetry (Sensor > Telemetry:
+// Binary). Reads the serial stream from a file or stdin and prints CSV, or a
+// one-line-per-frame console plot with --plot. Text lines in the stream are
+// passed through to stderr.
+//
+// Build:  g++ -std=c++11 -O2 -o telemetry_decode tools/telemetry_decode.cpp
+// Use:    stty -F /dev/ttyUSB0 115200 raw && ./telemetry_decode /dev/ttyUSB0
+//         ./telemetry_decode --plot < capture.bin
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "../src/TelemetryFrame.h"
+
+static const int PLOT_WIDTH = 72;
+static const float PLOT_MAX_C = 260.0f;
+
+static void printCsv(const TelemetryFrame& f) {
+    printf("%u,%.2f,%.1f,%.1f,%.2f,%.1f,%.1f,%.1f,%.1f,%.1f,%u,%u,%u,%u",
+           f.seq, f.timeMs / 1000.0, f.temp / 10.0, f.setpoint / 10.0, f.rate / 100.0,
+           f.p / 10.0, f.i / 10.0, f.d / 10.0, f.feedForward / 10.0, f.output / 10.0,
+           f.mainPWM, f.fryPWM, f.fanDuty, f.phase);
+    for (int k = 0; k < TELEMETRY_PROBES; ++k) {
+        if (f.probes[k] == TELEMETRY_NO_READING) printf(",");
+        else printf(",%.1f", f.probes[k] / 10.0);
+    }
+    printf(",%u\n", (f.flags & TELEMETRY_FLAG_SENSOR_FAULT) ? 1 : 0);
+}
+
+// Temperature '*' and setpoint '|' on a 0..PLOT_MAX_C axis, output as a bar
+static void printPlot(const TelemetryFrame& f) {
+    char line[PLOT_WIDTH + 1];
+    memset(line, ' ', PLOT_WIDTH);
+    line[PLOT_WIDTH] = 0;
+    int outCols = f.output * (PLOT_WIDTH / 4) / 1000;
+    for (int c = 0; c < outCols && c < PLOT_WIDTH; ++c) line[c] = '.';
+    int sp = (int)(f.setpoint / 10.0f / PLOT_MAX_C * (PLOT_WIDTH - 1));
+    int t = (int)(f.temp / 10.0f / PLOT_MAX_C * (PLOT_WIDTH - 1));
+    if (sp >= 0 && sp < PLOT_WIDTH) line[sp] = '|';
+    if (t >= 0 && t < PLOT_WIDTH) line[t] = '*';
+    printf("%6.1fs %5.1fC %+5.2f/s %s\n", f.timeMs / 1000.0, f.temp / 10.0, f.rate / 100.0, line);
+}
+
+int main(int argc, char** argv) {
+    bool plot = false;
+    const char* path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--plot") == 0) plot = true;
+        else path = argv[i];
+    }
+    FILE* in = path ? fopen(path, "rb") : stdin;
+    if (!in) {
+        perror(path);
+        return 1;
+    }
+    if (!plot) printf("seq,time_s,temp,setpoint,rate,p,i,d,ff,output,main,fry,fan,phase,probe1,probe2,probe3,probe4,fault\n");
+
+    std::vector<uint8_t> block;
+    uint8_t raw[sizeof(TelemetryFrame) + 2];
+    bool haveSeq = false;
+    uint16_t lastSeq = 0;
+    unsigned long frames = 0, bad = 0, lost = 0, crcFailed = 0;
+    int ch;
+    while ((ch = fgetc(in)) != EOF) {
+        if (ch != 0) {
+            if (block.size() < 4096) block.push_back((uint8_t)ch);
+            continue;
+        }
+        size_t len = cobsDecode(block.data(), block.size(), raw, sizeof(raw));
+        TelemetryFrame f;
+        bool crcOk = len == sizeof(raw) &&
+                     telemetryCrc16(raw, sizeof(f)) == (raw[sizeof(f)] | (raw[sizeof(f) + 1] << 8));
+        if (crcOk) {
+            memcpy(&f, raw, sizeof(f));
+            if (f.type == TELEMETRY_FRAME_CONTROL && f.version == TELEMETRY_VERSION) {
+                if (haveSeq && f.seq != (uint16_t)(lastSeq + 1)) {
+                    lost += (uint16_t)(f.seq - lastSeq - 1);
+                }
+                haveSeq = true;
+                lastSeq = f.seq;
+                frames++;
+                if (plot) printPlot(f);
+                else printCsv(f);
+                fflush(stdout);
+            }
+        } else if (len == sizeof(raw)) {
+            // Frame-sized but corrupted on the wire
+            crcFailed++;
+        } else if (!block.empty()) {
+            // Not a frame: most likely a text log line
+            bad++;
+            fwrite(block.data(), 1, block.size(), stderr);
+        }
+        block.clear();
+    }
+    fprintf(stderr, "\n%lu frames, %lu lost, %lu CRC failures, %lu non-frame blocks\n",
+            frames, lost, crcFailed, bad);
+    if (in != stdin) fclose(in);
+    return 0;
+}